@@ -42,6 +42,17 @@ public class MasterHttpRequest : ModuleRules
 			}
 			);
 
+		// Response decoding (gzip / deflate)
+		AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
+
+		// Load test mock server (MasterHttp.LoadTest / -run=MasterHttpLoadTest), left out of shipping builds
+		bool bWithLoadTest = Target.Configuration != UnrealTargetConfiguration.Shipping;
+		if (bWithLoadTest)
+		{
+			PrivateDependencyModuleNames.Add("HTTPServer");
+		}
+		PrivateDefinitions.Add("MASTERHTTP_WITH_LOADTEST=" + (bWithLoadTest ? "1" : "0"));
+
 
 		DynamicallyLoadedModuleNames.AddRange(
 			new string[]
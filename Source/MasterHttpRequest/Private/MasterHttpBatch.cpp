@@ -0,0 +1,187 @@
+/*
+==========================================================================================
+File: MasterHttpBatch.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterHttpBatch.h"
+#include "MasterHttpClient.h"
+#include "MasterHttpRequest.h"
+#include "MasterHttpRequestInternal.h"
+#include "MasterHttpRequestRegistry.h"
+#include "MasterHttpTrace.h"
+#include "Async/Async.h"
+
+namespace MasterHttp
+{
+    /** Shared by every item of a batch. Only touched on the game thread, where all item completions run. */
+    struct FBatchState
+    {
+        TWeakObjectPtr<UMasterHttpClient> Client;
+        TArray<FHttpRequestDescriptor> Requests;
+        TArray<FHttpRequestHandle> Handles;     // One per request once started, to cancel them when the batch ends early
+        TSharedPtr<FMasterHttpRequestRegistry, ESPMode::ThreadSafe> Registry;
+        TSharedPtr<FMasterHttpRequestState, ESPMode::ThreadSafe> BatchState;  // The batch, as seen by its handle
+        TFunction<void(const FHttpBatchResult&)> OnComplete;
+        FHttpBatchResult Result;
+        TBitArray<> Finished;
+        int32 NextIndex = 0;
+        int32 InFlight = 0;
+        int32 MaxConcurrency = 1;
+        double StartTime = 0.0;
+        bool bFailFast = false;
+        bool bCompleted = false;
+    };
+
+    static void LaunchNext(const TSharedRef<FBatchState>& State);
+
+    static void CompleteBatch(const TSharedRef<FBatchState>& State)
+    {
+        if (State->bCompleted)
+            return;
+        State->bCompleted = true;
+
+        // Anything not answered by now was skipped by fail-fast or cancellation. Requests still in flight are cancelled
+        // so they stop using bandwidth, scheduler slots and rate limit tokens; their completions are ignored.
+        const bool bCancelled = State->BatchState->IsCancelRequested();
+        for (int32 Index = 0; Index < State->Result.Responses.Num(); ++Index)
+        {
+            if (!State->Finished[Index])
+            {
+                FHttpResponseSimple& Skipped = State->Result.Responses[Index];
+                Skipped.URL = State->Requests[Index].URL;
+                Skipped.ErrorKind = EHttpErrorKind::Cancelled;
+                Skipped.ErrorMessage = bCancelled ? TEXT("Not completed: the batch was cancelled") : TEXT("Not completed: the batch ended before this request finished");
+                ++State->Result.SkippedCount;
+            }
+        }
+
+        TArray<FHttpRequestHandle> Handles = MoveTemp(State->Handles);
+        for (int32 Index = 0; Index < Handles.Num(); ++Index)
+        {
+            if (!State->Finished[Index])
+            {
+                UMasterHttpRequestBPLibrary::CancelHttpRequest(Handles[Index]);
+            }
+        }
+
+        State->Result.bAllSucceeded = State->Result.SucceededCount == State->Result.Responses.Num();
+        State->Result.TotalDurationSeconds = static_cast<float>(FPlatformTime::Seconds() - State->StartTime);
+        State->Requests.Empty();
+
+        State->BatchState->Finish(State->Result.bAllSucceeded);
+        State->Registry->Unregister(State->BatchState->RequestId);
+
+        TFunction<void(const FHttpBatchResult&)> OnComplete = MoveTemp(State->OnComplete);
+        OnComplete(State->Result);
+    }
+
+    static void OnItemComplete(const TSharedRef<FBatchState>& State, int32 Index, const FMasterHttpResult& ItemResult)
+    {
+        --State->InFlight;
+        if (State->bCompleted)
+            return;
+
+        FHttpResponseSimple RespData = MakeResponse(ItemResult, GetResponseBodyMode(State->Requests[Index].Options), State->Requests[Index].Options.bSplitResponseHeaders);
+        if (State->Requests[Index].Options.DebugLevel != EDebugLevel::None)
+        {
+            const FHttpRequestDescriptor& Request = State->Requests[Index];
+            UMasterHttpRequestBPLibrary::LogDebugInfo(ItemResult.FinalURL, Request.Method, Request.QueryParams, Request.CustomHeaders, Request.Body, RespData, Request.Options);
+        }
+
+        const bool bSuccess = RespData.bSuccess;
+        State->Result.Responses[Index] = MoveTemp(RespData);
+        State->Finished[Index] = true;
+
+        if (bSuccess)
+        {
+            ++State->Result.SucceededCount;
+        }
+        else
+        {
+            ++State->Result.FailedCount;
+            if (State->bFailFast)
+            {
+                CompleteBatch(State);
+                return;
+            }
+        }
+
+        LaunchNext(State);
+    }
+
+    static void LaunchNext(const TSharedRef<FBatchState>& State)
+    {
+        UMasterHttpClient* Client = State->Client.Get();
+        while (Client && State->InFlight < State->MaxConcurrency && State->NextIndex < State->Requests.Num())
+        {
+            const int32 Index = State->NextIndex++;
+            ++State->InFlight;
+            FHttpRequestHandle Handle = Client->ProcessRequest(State->Requests[Index], false, [State, Index](const FMasterHttpResult& ItemResult) {
+                OnItemComplete(State, Index, ItemResult);
+            });
+
+            // Completed from inside ProcessRequest (cache hit, fail-fast): the batch may be over already
+            if (State->bCompleted)
+            {
+                if (!State->Finished[Index])
+                {
+                    UMasterHttpRequestBPLibrary::CancelHttpRequest(Handle);
+                }
+                return;
+            }
+            State->Handles[Index] = MoveTemp(Handle);
+        }
+
+        if (State->InFlight == 0 && !State->bCompleted)
+        {
+            // Either everything finished, or the client went away before the rest could start
+            CompleteBatch(State);
+        }
+    }
+
+    FHttpRequestHandle SendBatch(UMasterHttpClient* Client, TArray<FHttpRequestDescriptor> Requests, int32 MaxConcurrency, bool bFailFast, FName Tag, TFunction<void(const FHttpBatchResult&)> OnComplete)
+    {
+        TSharedRef<FBatchState> State = MakeShared<FBatchState>();
+        State->Registry = FMasterHttpRequestModule::Get().GetRequestRegistry();
+        State->BatchState = State->Registry->Register(AllocateRequestId(), Tag);
+        State->Client = Client;
+        State->OnComplete = MoveTemp(OnComplete);
+        State->MaxConcurrency = FMath::Max(1, MaxConcurrency);
+        State->bFailFast = bFailFast;
+        State->StartTime = FPlatformTime::Seconds();
+        State->Result.Responses.SetNum(Requests.Num());
+        State->Finished.Init(false, Requests.Num());
+        State->Requests = MoveTemp(Requests);
+        State->Handles.SetNum(State->Requests.Num());
+
+        FHttpRequestHandle Handle;
+        Handle.RequestId = State->BatchState->RequestId;
+        Handle.State = State->BatchState;
+
+        // Cancelling the batch (directly, by tag or all) may come from any thread; the batch completes on the game thread
+        State->BatchState->SetOnCancel([WeakState = TWeakPtr<FBatchState>(State)]() {
+            AsyncTask(ENamedThreads::GameThread, [WeakState]() {
+                if (TSharedPtr<FBatchState> Pinned = WeakState.Pin())
+                {
+                    CompleteBatch(Pinned.ToSharedRef());
+                }
+            });
+        });
+
+        if (State->Requests.IsEmpty() || !Client)
+        {
+            // Keep completion asynchronous even when there is nothing to send
+            AsyncTask(ENamedThreads::GameThread, [State]() {
+                CompleteBatch(State);
+            });
+            return Handle;
+        }
+
+        State->BatchState->State = EHttpRequestState::InFlight;
+        LaunchNext(State);
+        return Handle;
+    }
+}
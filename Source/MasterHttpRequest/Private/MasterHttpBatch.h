@@ -0,0 +1,26 @@
+/*
+==========================================================================================
+File: MasterHttpBatch.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MasterHttpRequestBPLibrary.h"
+
+class UMasterHttpClient;
+
+/** Many independent requests joined into one completion (internal use). */
+namespace MasterHttp
+{
+    /**
+    * Send Requests through Client with at most MaxConcurrency of them in flight, and call OnComplete once on the game thread
+    * with every response in request order. With bFailFast the first failure completes the batch: requests not yet started
+    * are skipped and requests still in flight are cancelled.
+    * @return Handle of the whole batch, tagged with Tag. Cancelling it cancels every unfinished request and completes the batch.
+    */
+    FHttpRequestHandle SendBatch(UMasterHttpClient* Client, TArray<FHttpRequestDescriptor> Requests, int32 MaxConcurrency, bool bFailFast, FName Tag, TFunction<void(const FHttpBatchResult&)> OnComplete);
+}
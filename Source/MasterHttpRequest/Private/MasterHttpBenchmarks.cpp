@@ -0,0 +1,361 @@
+/*
+==========================================================================================
+File: MasterHttpBenchmarks.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "MasterHttpRequestBPLibrary.h"
+#include "MasterJsonDocument.h"
+#include "MasterHttpRequestInternal.h"
+#include "HttpModule.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "MasterHttpBenchmarks.h"
+#include "Json.h"
+#include "Async/Async.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace MasterHttpBenchmarks
+{
+    /** Build a payload shaped like an inventory response: a flat "meta" object plus a large "items" array. */
+    static FString MakeInventoryPayload(int32 FieldCount, int32 PayloadKB)
+    {
+        FString Json;
+        Json.Reserve(PayloadKB * 1024 + 1024);
+        Json += TEXT("{\"meta\":{");
+        for (int32 i = 0; i < FieldCount; ++i)
+        {
+            Json += FString::Printf(TEXT("%s\"field_%d\":\"value_%d\""), i > 0 ? TEXT(",") : TEXT(""), i, i);
+        }
+        Json += TEXT("},\"items\":[");
+        for (int32 i = 0; Json.Len() < PayloadKB * 1024; ++i)
+        {
+            Json += FString::Printf(TEXT("%s{\"id\":%d,\"name\":\"item_%d\",\"price\":%d.99,\"tags\":[\"a\",\"b\"]}"), i > 0 ? TEXT(",") : TEXT(""), i, i, i % 100);
+        }
+        Json += TEXT("]}");
+        return Json;
+    }
+
+    static void RunJsonBenchmark(const TArray<FString>& Args)
+    {
+        const int32 FieldCount = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 20;
+        const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 10;
+        const int32 PayloadKB = Args.Num() > 2 ? FMath::Max(1, FCString::Atoi(*Args[2])) : 300;
+
+        const FString Payload = MakeInventoryPayload(FieldCount, PayloadKB);
+        TArray<FString> Paths;
+        for (int32 i = 0; i < FieldCount; ++i)
+        {
+            Paths.Add(FString::Printf(TEXT("meta.field_%d"), i));
+        }
+
+        // Current approach: one DecodeJson call (and one full parse) per field
+        EJsonDecodeResult Result;
+        FString Value;
+        TArray<FHttpKeyValue> ObjectFields;
+        TArray<FString> ArrayValues;
+        const double DecodeStart = FPlatformTime::Seconds();
+        for (int32 Iter = 0; Iter < Iterations; ++Iter)
+        {
+            for (const FString& Path : Paths)
+            {
+                UMasterHttpRequestBPLibrary::DecodeJson(Payload, Path, Result, Value, ObjectFields, ArrayValues);
+            }
+        }
+        const double DecodeSeconds = FPlatformTime::Seconds() - DecodeStart;
+
+        // Document approach: parse once, then cached path lookups
+        const double DocumentStart = FPlatformTime::Seconds();
+        for (int32 Iter = 0; Iter < Iterations; ++Iter)
+        {
+            bool bParsed = false;
+            UMasterJsonDocument* Document = UMasterJsonDocument::ParseJsonString(Payload, bParsed);
+            if (!Document)
+                continue;
+            for (const FString& Path : Paths)
+            {
+                Document->GetString(Path, Value);
+            }
+        }
+        const double DocumentSeconds = FPlatformTime::Seconds() - DocumentStart;
+
+        // Query approach: parse once, then every path in one walk, plus a wildcard over the items array
+        TArray<FString> QueryPaths = Paths;
+        QueryPaths.Add(TEXT("items[*].price"));
+        TArray<FJsonQueryResult> QueryResults;
+        const double QueryStart = FPlatformTime::Seconds();
+        for (int32 Iter = 0; Iter < Iterations; ++Iter)
+        {
+            UMasterJsonDocument::QueryJsonString(Payload, QueryPaths, QueryResults);
+        }
+        const double QuerySeconds = FPlatformTime::Seconds() - QueryStart;
+        const int32 PriceCount = QueryResults.Num() > 0 ? QueryResults.Last().Numbers.Num() : 0;
+
+        UE_LOG(LogTemp, Display, TEXT("📊 JSON extraction benchmark: %d fields, %d iterations, %d KB payload"), FieldCount, Iterations, Payload.Len() / 1024);
+        UE_LOG(LogTemp, Display, TEXT("   DecodeJson loop:    %.3f ms per response"), DecodeSeconds * 1000.0 / Iterations);
+        UE_LOG(LogTemp, Display, TEXT("   UMasterJsonDocument: %.3f ms per response"), DocumentSeconds * 1000.0 / Iterations);
+        UE_LOG(LogTemp, Display, TEXT("   Speedup: %.1fx"), DocumentSeconds > 0.0 ? DecodeSeconds / DocumentSeconds : 0.0);
+        UE_LOG(LogTemp, Display, TEXT("   QueryJsonString:    %.3f ms per response (fields + %d prices from items[*].price)"), QuerySeconds * 1000.0 / Iterations, PriceCount);
+    }
+}
+
+namespace MasterHttpBenchmarks
+{
+    /**
+    * Allocation calls made while running Body, Iterations times, averaged per iteration. Process-wide: run it
+    * on an idle client, since allocations made meanwhile by other threads are included.
+    */
+    template<typename FunctorType>
+    static double CountAllocationsPerCall(int32 Iterations, FunctorType&& Body)
+    {
+        const uint64 Before = GetAllocationCallCount();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            Body();
+        }
+        return static_cast<double>(GetAllocationCallCount() - Before) / Iterations;
+    }
+
+    /**
+    * The request construction path of the original SendHttpRequest, copied verbatim as the benchmark baseline:
+    * the [=] capture, the task-graph hop, the switch-built strings and the completion binding. Only
+    * ProcessRequest is left out, and the hop is waited on so iterations do not overlap.
+    */
+    static void BuildRequestLegacy(
+        const FString& URL,
+        EHttpMethod Method,
+        TArray<FHttpHeaderEnumValue> DefaultHeaders,
+        TArray<FHttpKeyValue> CustomHeaders,
+        TArray<FHttpKeyValue> QueryParams,
+        TArray<FHttpKeyValue> Body,
+        FHttpResponseDelegate Callback,
+        FHttpOptions Options)
+    {
+        auto RequestLambda = [=]() {
+            double StartTime = FPlatformTime::Seconds();
+
+            FString FinalURL = URL;
+            if (QueryParams.Num() > 0)
+            {
+                TArray<FString> QueryArray;
+                for (const auto& Param : QueryParams)
+                {
+                    QueryArray.Add(FGenericPlatformHttp::UrlEncode(Param.Key) + TEXT("=") + FGenericPlatformHttp::UrlEncode(Param.Value));
+                }
+                FinalURL += (URL.Contains(TEXT("?")) ? TEXT("&") : TEXT("?")) + FString::Join(QueryArray, TEXT("&"));
+            }
+
+            TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+            HttpRequest->SetURL(FinalURL);
+
+            FString Verb;
+            switch (Method)
+            {
+                case EHttpMethod::GET: Verb = TEXT("GET"); break;
+                case EHttpMethod::POST: Verb = TEXT("POST"); break;
+                case EHttpMethod::PUT: Verb = TEXT("PUT"); break;
+                case EHttpMethod::DELETE: Verb = TEXT("DELETE"); break;
+                case EHttpMethod::PATCH: Verb = TEXT("PATCH"); break;
+                default: Verb = TEXT("GET"); break;
+            }
+            HttpRequest->SetVerb(Verb);
+
+            // Build headers with improved content type handling
+            TMap<FString, FString> FinalHeaders;
+
+            // Add default JSON headers if not overridden
+            for (const auto& H : UMasterHttpRequestBPLibrary::GetDefaultJsonHeaders())
+            {
+                FinalHeaders.Add(H.Key, H.Value);
+            }
+
+            // Handle content type from options
+            FString ContentTypeValue;
+            switch (Options.ContentType)
+            {
+                case EContentType::ApplicationJson: ContentTypeValue = TEXT("application/json"); break;
+                case EContentType::ApplicationXml: ContentTypeValue = TEXT("application/xml"); break;
+                case EContentType::ApplicationFormEncoded: ContentTypeValue = TEXT("application/x-www-form-urlencoded"); break;
+                case EContentType::MultipartFormData: ContentTypeValue = TEXT("multipart/form-data"); break;
+                case EContentType::TextPlain: ContentTypeValue = TEXT("text/plain"); break;
+                case EContentType::TextHtml: ContentTypeValue = TEXT("text/html"); break;
+                case EContentType::TextXml: ContentTypeValue = TEXT("text/xml"); break;
+                case EContentType::Custom: ContentTypeValue = Options.CustomContentType; break;
+                default: ContentTypeValue = TEXT("application/json"); break;
+            }
+            if (!ContentTypeValue.IsEmpty())
+            {
+                FinalHeaders.Add(TEXT("Content-Type"), ContentTypeValue);
+            }
+
+            // Process enum-based headers with improved key mapping
+            for (const auto& H : DefaultHeaders)
+            {
+                FString KeyStr;
+                switch (H.Key)
+                {
+                    case EHttpHeaderKey::Authorization: KeyStr = TEXT("Authorization"); break;
+                    case EHttpHeaderKey::ContentType: KeyStr = TEXT("Content-Type"); break;
+                    case EHttpHeaderKey::Accept: KeyStr = TEXT("Accept"); break;
+                    case EHttpHeaderKey::UserAgent: KeyStr = TEXT("User-Agent"); break;
+                    case EHttpHeaderKey::AcceptLanguage: KeyStr = TEXT("Accept-Language"); break;
+                    case EHttpHeaderKey::AcceptEncoding: KeyStr = TEXT("Accept-Encoding"); break;
+                    case EHttpHeaderKey::CacheControl: KeyStr = TEXT("Cache-Control"); break;
+                    case EHttpHeaderKey::Connection: KeyStr = TEXT("Connection"); break;
+                    case EHttpHeaderKey::Cookie: KeyStr = TEXT("Cookie"); break;
+                    case EHttpHeaderKey::Host: KeyStr = TEXT("Host"); break;
+                    case EHttpHeaderKey::Origin: KeyStr = TEXT("Origin"); break;
+                    case EHttpHeaderKey::Referer: KeyStr = TEXT("Referer"); break;
+                    case EHttpHeaderKey::XRequestedWith: KeyStr = TEXT("X-Requested-With"); break;
+                    case EHttpHeaderKey::XApiKey: KeyStr = TEXT("X-API-Key"); break;
+                    case EHttpHeaderKey::XAuthToken: KeyStr = TEXT("X-Auth-Token"); break;
+                    case EHttpHeaderKey::XCSRFToken: KeyStr = TEXT("X-CSRF-Token"); break;
+                    case EHttpHeaderKey::Custom: KeyStr = H.CustomKey; break;
+                    default: continue;
+                }
+                if (!KeyStr.IsEmpty())
+                {
+                    FinalHeaders.Add(KeyStr, H.Value);
+                }
+            }
+
+            // Add custom headers (these can override defaults)
+            for (const auto& H : CustomHeaders)
+            {
+                FinalHeaders.Add(H.Key, H.Value);
+            }
+
+            // Apply all headers to request
+            for (const auto& Pair : FinalHeaders)
+            {
+                HttpRequest->SetHeader(Pair.Key, Pair.Value);
+            }
+
+            // Handle request body for methods that support it
+            FString BodyString;
+            if (Verb == TEXT("POST") || Verb == TEXT("PUT") || Verb == TEXT("PATCH"))
+            {
+                if (Options.ContentType == EContentType::ApplicationFormEncoded)
+                {
+                    // URL-encoded form data
+                    TArray<FString> BodyPairs;
+                    for (const auto& KV : Body)
+                    {
+                        BodyPairs.Add(FGenericPlatformHttp::UrlEncode(KV.Key) + TEXT("=") + FGenericPlatformHttp::UrlEncode(KV.Value));
+                    }
+                    BodyString = FString::Join(BodyPairs, TEXT("&"));
+                }
+                else
+                {
+                    // JSON body (default)
+                    TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
+                    for (const auto& KV : Body)
+                    {
+                        JsonObject->SetStringField(KV.Key, KV.Value);
+                    }
+                    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&BodyString);
+                    FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+                }
+                HttpRequest->SetContentAsString(BodyString);
+            }
+
+            // Apply advanced options
+            HttpRequest->SetTimeout(Options.TimeoutSeconds);
+
+            HttpRequest->OnProcessRequestComplete().BindLambda([=](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful) {
+                double EndTime = FPlatformTime::Seconds();
+                float Duration = static_cast<float>(EndTime - StartTime);
+
+                FHttpResponseSimple RespData;
+                RespData.bSuccess = bWasSuccessful && Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode());
+                RespData.Data = Response.IsValid() ? Response->GetContentAsString() : TEXT("");
+                RespData.StatusCode = Response.IsValid() ? Response->GetResponseCode() : -1;
+                RespData.StatusText = UMasterHttpRequestBPLibrary::GetStatusText(RespData.StatusCode);
+                RespData.ErrorMessage = bWasSuccessful ? TEXT("") : (Response.IsValid() ? Response->GetContentAsString() : TEXT("Request failed - no response received"));
+                RespData.RequestDurationSeconds = Duration;
+                RespData.URL = FinalURL;
+                RespData.ContentLength = Response.IsValid() ? Response->GetContentLength() : 0;
+                RespData.ContentType = Response.IsValid() ? Response->GetContentType() : TEXT("");
+
+                if (Response.IsValid())
+                {
+                    for (const auto& Header : Response->GetAllHeaders())
+                    {
+                        FString Key, Value;
+                        if (Header.Split(TEXT(": "), &Key, &Value))
+                        {
+                            RespData.Headers.Add(UMasterHttpRequestBPLibrary::MakeKeyValue(Key, Value));
+                        }
+                    }
+                }
+
+                // Enhanced debug logging
+                if (Options.DebugLevel != EDebugLevel::None)
+                {
+                    UMasterHttpRequestBPLibrary::LogDebugInfo(FinalURL, Method, QueryParams, CustomHeaders, Body, RespData, Options);
+                }
+
+                Callback.ExecuteIfBound(RespData);
+            });
+        };
+
+        Async(EAsyncExecution::TaskGraph, RequestLambda).Wait();
+    }
+
+    static void RunRequestAllocBenchmark(const TArray<FString>& Args)
+    {
+        const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+
+        FHttpRequestDescriptor Request;
+        Request.URL = TEXT("https://api.example.com/v1/items");
+        Request.Method = EHttpMethod::POST;
+        Request.DefaultHeaders.Add(UMasterHttpRequestBPLibrary::MakeBearerToken(TEXT("token")));
+        Request.DefaultHeaders.Add(UMasterHttpRequestBPLibrary::MakeApiKey(TEXT("key")));
+        Request.CustomHeaders.Add(UMasterHttpRequestBPLibrary::MakeKeyValue(TEXT("X-Client"), TEXT("bench")));
+        Request.QueryParams.Add(UMasterHttpRequestBPLibrary::MakeKeyValue(TEXT("page"), TEXT("1")));
+        Request.QueryParams.Add(UMasterHttpRequestBPLibrary::MakeKeyValue(TEXT("limit"), TEXT("50")));
+        Request.Body.Add(UMasterHttpRequestBPLibrary::MakeKeyValue(TEXT("name"), TEXT("sword")));
+        Request.Body.Add(UMasterHttpRequestBPLibrary::MakeKeyValue(TEXT("rarity"), TEXT("epic")));
+
+        // Requests are built but never processed, so nothing goes out on the network
+        const double LegacyStart = FPlatformTime::Seconds();
+        const double LegacyAllocs = CountAllocationsPerCall(Iterations, [&Request]() {
+            BuildRequestLegacy(Request.URL, Request.Method, Request.DefaultHeaders, Request.CustomHeaders, Request.QueryParams, Request.Body, FHttpResponseDelegate(), Request.Options);
+        });
+        const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+
+        const double FastStart = FPlatformTime::Seconds();
+        const double FastAllocs = CountAllocationsPerCall(Iterations, [&Request]() {
+            // The same completion binding the scheduler's attempt makes, so both sides include it
+            FString FinalURL;
+            TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = MasterHttp::BuildRequest(Request, FinalURL);
+            HttpRequest->OnProcessRequestComplete().BindLambda([FinalURL = MoveTemp(FinalURL)](FHttpRequestPtr InRequest, FHttpResponsePtr Response, bool bWasSuccessful) {
+            });
+        });
+        const double FastSeconds = FPlatformTime::Seconds() - FastStart;
+
+        UE_LOG(LogTemp, Display, TEXT("📊 Request construction benchmark: %d iterations (process-wide allocation calls)"), Iterations);
+        UE_LOG(LogTemp, Display, TEXT("   Legacy path:   %s allocations, %.2f us per request"), *FormatAllocationCount(LegacyAllocs), LegacySeconds * 1000000.0 / Iterations);
+        UE_LOG(LogTemp, Display, TEXT("   Inline path:   %s allocations, %.2f us per request"), *FormatAllocationCount(FastAllocs), FastSeconds * 1000000.0 / Iterations);
+        if (!bCanCountAllocations)
+        {
+            UE_LOG(LogTemp, Display, TEXT("   Allocation counts need a build with stats enabled (UE_STATS); only timings are valid here"));
+        }
+    }
+}
+
+static FAutoConsoleCommand GMasterHttpBenchRequestAllocsCommand(
+    TEXT("MasterHttp.Bench.RequestAllocs"),
+    TEXT("Count heap allocations per request build for the legacy and inline request paths. Usage: MasterHttp.Bench.RequestAllocs [Iterations=1000]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&MasterHttpBenchmarks::RunRequestAllocBenchmark));
+
+static FAutoConsoleCommand GMasterHttpBenchJsonCommand(
+    TEXT("MasterHttp.Bench.Json"),
+    TEXT("Compare N-field extraction with DecodeJson against a parse-once UMasterJsonDocument. Usage: MasterHttp.Bench.Json [Fields=20] [Iterations=10] [PayloadKB=300]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&MasterHttpBenchmarks::RunJsonBenchmark));
+
+#endif // !UE_BUILD_SHIPPING
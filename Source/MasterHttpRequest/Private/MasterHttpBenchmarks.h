@@ -0,0 +1,55 @@
+/*
+==========================================================================================
+File: MasterHttpBenchmarks.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/MemoryBase.h"
+#include <atomic>
+
+#if !UE_BUILD_SHIPPING
+
+/** Shared helpers for the development benchmarks and the load test (internal use). */
+namespace MasterHttpBenchmarks
+{
+#if UE_STATS
+    /** Reaches the allocator's protected call counters, which only exist in stats builds. Never instantiated. */
+    struct FMallocCallCounters : FMalloc
+    {
+        static uint64 Get()
+        {
+            return TotalMallocCalls.load(std::memory_order_relaxed) + TotalReallocCalls.load(std::memory_order_relaxed);
+        }
+    };
+#endif
+
+    /** True when GetAllocationCallCount returns real counts; false in builds without stats (e.g. Test). */
+    inline constexpr bool bCanCountAllocations = UE_STATS != 0;
+
+    /**
+     * Heap allocation calls (Malloc and Realloc) made so far by the whole process, as counted by the engine allocator.
+     * Read it before and after a measured section: nothing is swapped or hooked, so other threads are never affected,
+     * but their allocations during the section are included. Always 0 without stats; see bCanCountAllocations.
+     */
+    inline uint64 GetAllocationCallCount()
+    {
+#if UE_STATS
+        return FMallocCallCounters::Get();
+#else
+        return 0;
+#endif
+    }
+
+    /** An allocation count for a log line or CSV cell, or "n/a" when allocations are not counted in this build. */
+    inline FString FormatAllocationCount(double Allocations)
+    {
+        return bCanCountAllocations ? FString::Printf(TEXT("%.1f"), Allocations) : FString(TEXT("n/a"));
+    }
+}
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,351 @@
+/*
+==========================================================================================
+File: MasterHttpCache.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterHttpCache.h"
+#include "MasterHttpRequestInternal.h"
+#include "Async/Async.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace MasterHttp
+{
+    static constexpr int32 CacheFileVersion = 1;
+
+    /** Serves a cache entry through the engine response interface. */
+    class FCachedHttpResponse final : public IHttpResponse
+    {
+    public:
+        FCachedHttpResponse(const FMasterHttpCacheEntryPtr& InEntry, const FString& InURL, const TCHAR* CacheStatus)
+            : Entry(InEntry)
+            , URL(InURL)
+            , Headers(InEntry->Headers)
+        {
+            // Lets callers tell cached responses apart in Response.Headers
+            Headers.Add(FString::Printf(TEXT("X-MasterHttp-Cache: %s"), CacheStatus));
+        }
+
+        virtual const FString& GetURL() const override { return URL; }
+        virtual const FString& GetEffectiveURL() const override { return URL; }
+        virtual FString GetURLParameter(const FString& ParameterName) const override { return FGenericPlatformHttp::GetUrlParameter(URL, ParameterName).Get(FString()); }
+        virtual EHttpRequestStatus::Type GetStatus() const override { return EHttpRequestStatus::Succeeded; }
+        virtual EHttpFailureReason GetFailureReason() const override { return EHttpFailureReason::None; }
+
+        virtual FString GetHeader(const FString& HeaderName) const override
+        {
+            for (const FString& Header : Headers)
+            {
+                int32 Colon = INDEX_NONE;
+                if (Header.FindChar(TEXT(':'), Colon) && FStringView(*Header, Colon).Equals(HeaderName, ESearchCase::IgnoreCase))
+                {
+                    return Header.Mid(Colon + 1).TrimStart();
+                }
+            }
+            return FString();
+        }
+
+        virtual TArray<FString> GetAllHeaders() const override { return Headers; }
+        virtual FString GetContentType() const override { return Entry->ContentType; }
+        virtual uint64 GetContentLength() const override { return Entry->Content.Num(); }
+        virtual const TArray<uint8>& GetContent() const override { return Entry->Content; }
+        virtual int32 GetResponseCode() const override { return Entry->StatusCode; }
+
+        virtual FString GetContentAsString() const override
+        {
+            FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Entry->Content.GetData()), Entry->Content.Num());
+            return FString::ConstructFromPtrSize(Converted.Get(), Converted.Length());
+        }
+
+        virtual FUtf8StringView GetContentAsUtf8StringView() const override
+        {
+            return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Entry->Content.GetData()), Entry->Content.Num());
+        }
+
+    private:
+        FMasterHttpCacheEntryPtr Entry;
+        FString URL;
+        TArray<FString> Headers;
+    };
+
+    /** Look up a Cache-Control directive; returns false if absent. OutValue receives the directive's value, if any. */
+    static bool FindCacheDirective(const FString& CacheControl, const TCHAR* Directive, FString* OutValue = nullptr)
+    {
+        TArray<FString> Directives;
+        CacheControl.ParseIntoArray(Directives, TEXT(","));
+        for (FString& Item : Directives)
+        {
+            Item.TrimStartAndEndInline();
+            FString Name = Item, Value;
+            Item.Split(TEXT("="), &Name, &Value);
+            if (Name.TrimEnd().Equals(Directive, ESearchCase::IgnoreCase))
+            {
+                if (OutValue)
+                {
+                    *OutValue = Value.TrimStartAndEnd().TrimQuotes();
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+bool FMasterHttpCacheEntry::IsFresh() const
+{
+    return ExpiresAtUtc > 0.0 && FDateTime::UtcNow().ToUnixTimestampDecimal() < ExpiresAtUtc;
+}
+
+FMasterHttpResponseCache::FMasterHttpResponseCache(int32 MaxMemoryEntries)
+    : Memory(FMath::Max(1, MaxMemoryEntries))
+{
+}
+
+FString FMasterHttpResponseCache::MakeKey(EHttpMethod Method, const FString& FinalURL)
+{
+    return Method == EHttpMethod::GET ? FString(TEXT("GET ")) + FinalURL : FString();
+}
+
+FMasterHttpCacheEntryPtr FMasterHttpResponseCache::Find(const FString& Key, const FHttpRequestDescriptor& Request, EHttpCachePolicy Policy)
+{
+    FMasterHttpCacheEntryPtr Entry;
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (const FMasterHttpCacheEntryPtr* Found = Memory.FindAndTouch(Key))
+        {
+            Entry = *Found;
+        }
+    }
+
+    if (!Entry.IsValid() && Policy == EHttpCachePolicy::MemoryAndDisk)
+    {
+        // Only a memory miss touches the disk; the entry is promoted so later lookups stay in memory
+        Entry = LoadFromDisk(Key);
+        if (Entry.IsValid())
+        {
+            FScopeLock ScopeLock(&Lock);
+            ++DiskReads;
+            Memory.Add(Key, Entry);
+        }
+    }
+
+    if (!Entry.IsValid())
+        return nullptr;
+
+    for (int32 Index = 0; Index < Entry->VaryNames.Num(); ++Index)
+    {
+        if (MasterHttp::FindRequestHeader(Request, Entry->VaryNames[Index]) != Entry->VaryValues[Index])
+            return nullptr;
+    }
+    return Entry;
+}
+
+bool FMasterHttpResponseCache::ApplyCacheHeaders(FMasterHttpCacheEntry& Entry, const FHttpResponsePtr& Response)
+{
+    const FString CacheControl = Response->GetHeader(TEXT("Cache-Control"));
+    if (MasterHttp::FindCacheDirective(CacheControl, TEXT("no-store")))
+        return false;
+
+    const FString ETag = Response->GetHeader(TEXT("ETag"));
+    const FString LastModified = Response->GetHeader(TEXT("Last-Modified"));
+    if (!ETag.IsEmpty())
+    {
+        Entry.ETag = ETag;
+    }
+    if (!LastModified.IsEmpty())
+    {
+        Entry.LastModified = LastModified;
+    }
+
+    // max-age wins over Expires; no-cache keeps the entry but forces revalidation every time
+    const double Now = FDateTime::UtcNow().ToUnixTimestampDecimal();
+    FString MaxAge;
+    FDateTime Expires;
+    if (MasterHttp::FindCacheDirective(CacheControl, TEXT("no-cache")))
+    {
+        Entry.ExpiresAtUtc = 0.0;
+    }
+    else if (MasterHttp::FindCacheDirective(CacheControl, TEXT("max-age"), &MaxAge))
+    {
+        const double Seconds = FCString::Atod(*MaxAge);
+        Entry.ExpiresAtUtc = Seconds > 0.0 ? Now + Seconds : 0.0;
+    }
+    else if (FDateTime::ParseHttpDate(Response->GetHeader(TEXT("Expires")), Expires))
+    {
+        const double ExpiresAt = Expires.ToUnixTimestampDecimal();
+        Entry.ExpiresAtUtc = ExpiresAt > Now ? ExpiresAt : 0.0;
+    }
+
+    // Nothing to reuse: never fresh and nothing to revalidate with
+    return Entry.ExpiresAtUtc > 0.0 || Entry.HasValidators();
+}
+
+FMasterHttpCacheEntryPtr FMasterHttpResponseCache::Store(const FString& Key, const FHttpRequestDescriptor& Request, const FHttpResponsePtr& Response, EHttpCachePolicy Policy)
+{
+    if (Key.IsEmpty() || !Response.IsValid() || Response->GetResponseCode() != EHttpResponseCodes::Ok)
+        return nullptr;
+
+    TSharedRef<FMasterHttpCacheEntry, ESPMode::ThreadSafe> Entry = MakeShared<FMasterHttpCacheEntry, ESPMode::ThreadSafe>();
+    Entry->Key = Key;
+    if (!ApplyCacheHeaders(*Entry, Response))
+        return nullptr;
+
+    const FString Vary = Response->GetHeader(TEXT("Vary"));
+    if (Vary.TrimStartAndEnd() == TEXT("*"))
+        return nullptr;
+
+    Vary.ParseIntoArray(Entry->VaryNames, TEXT(","));
+    for (FString& Name : Entry->VaryNames)
+    {
+        Name.TrimStartAndEndInline();
+        Entry->VaryValues.Add(MasterHttp::FindRequestHeader(Request, Name));
+    }
+
+    Entry->StatusCode = Response->GetResponseCode();
+    Entry->ContentType = Response->GetContentType();
+    Entry->Headers = Response->GetAllHeaders();
+    Entry->Content = Response->GetContent();
+
+    FMasterHttpCacheEntryPtr Stored = Entry;
+    {
+        FScopeLock ScopeLock(&Lock);
+        Memory.Add(Key, Stored);
+    }
+    if (Policy == EHttpCachePolicy::MemoryAndDisk)
+    {
+        WriteToDisk(Stored);
+    }
+    return Stored;
+}
+
+FMasterHttpCacheEntryPtr FMasterHttpResponseCache::Revalidate(const FMasterHttpCacheEntryPtr& Entry, const FHttpResponsePtr& NotModified, EHttpCachePolicy Policy)
+{
+    // Entries are shared with in-flight responses, so a refresh makes a new one instead of mutating it
+    TSharedRef<FMasterHttpCacheEntry, ESPMode::ThreadSafe> Refreshed = MakeShared<FMasterHttpCacheEntry, ESPMode::ThreadSafe>(*Entry);
+    if (NotModified.IsValid())
+    {
+        Refreshed->ExpiresAtUtc = 0.0;
+        ApplyCacheHeaders(*Refreshed, NotModified);
+    }
+
+    FMasterHttpCacheEntryPtr Stored = Refreshed;
+    {
+        FScopeLock ScopeLock(&Lock);
+        ++Revalidated;
+        Memory.Add(Stored->Key, Stored);
+    }
+    if (Policy == EHttpCachePolicy::MemoryAndDisk)
+    {
+        WriteToDisk(Stored);
+    }
+    return Stored;
+}
+
+FHttpResponsePtr FMasterHttpResponseCache::MakeCachedResponse(const FMasterHttpCacheEntryPtr& Entry, const FString& URL, const TCHAR* CacheStatus)
+{
+    return MakeShared<MasterHttp::FCachedHttpResponse, ESPMode::ThreadSafe>(Entry, URL, CacheStatus);
+}
+
+void FMasterHttpResponseCache::RecordHit()
+{
+    FScopeLock ScopeLock(&Lock);
+    ++Hits;
+}
+
+void FMasterHttpResponseCache::RecordMiss()
+{
+    FScopeLock ScopeLock(&Lock);
+    ++Misses;
+}
+
+void FMasterHttpResponseCache::Clear(bool bIncludeDisk)
+{
+    {
+        FScopeLock ScopeLock(&Lock);
+        Memory.Empty(Memory.Max());
+    }
+    if (bIncludeDisk)
+    {
+        IFileManager::Get().DeleteDirectory(*GetDiskDirectory(), false, true);
+    }
+}
+
+FHttpCacheStats FMasterHttpResponseCache::GetStats() const
+{
+    FScopeLock ScopeLock(&Lock);
+    FHttpCacheStats Stats;
+    Stats.MemoryEntries = Memory.Num();
+    Stats.Hits = Hits;
+    Stats.Revalidated = Revalidated;
+    Stats.Misses = Misses;
+    Stats.DiskReads = DiskReads;
+    return Stats;
+}
+
+FString FMasterHttpResponseCache::GetDiskDirectory()
+{
+    return FPaths::ProjectSavedDir() / TEXT("MasterHttpCache");
+}
+
+FString FMasterHttpResponseCache::GetDiskPath(const FString& Key)
+{
+    return GetDiskDirectory() / FMD5::HashAnsiString(*Key) + TEXT(".bin");
+}
+
+void FMasterHttpResponseCache::SerializeEntry(FArchive& Ar, FMasterHttpCacheEntry& Entry)
+{
+    Ar << Entry.Key;
+    Ar << Entry.StatusCode;
+    Ar << Entry.ContentType;
+    Ar << Entry.Headers;
+    Ar << Entry.ETag;
+    Ar << Entry.LastModified;
+    Ar << Entry.VaryNames;
+    Ar << Entry.VaryValues;
+    Ar << Entry.ExpiresAtUtc;
+    Ar << Entry.Content;
+}
+
+FMasterHttpCacheEntryPtr FMasterHttpResponseCache::LoadFromDisk(const FString& Key)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *GetDiskPath(Key), FILEREAD_Silent))
+        return nullptr;
+
+    FMemoryReader Reader(Bytes);
+    int32 Version = 0;
+    Reader << Version;
+    if (Version != MasterHttp::CacheFileVersion)
+        return nullptr;
+
+    TSharedRef<FMasterHttpCacheEntry, ESPMode::ThreadSafe> Entry = MakeShared<FMasterHttpCacheEntry, ESPMode::ThreadSafe>();
+    SerializeEntry(Reader, *Entry);
+
+    // A hash collision or a truncated file is treated as a miss
+    if (Reader.IsError() || Entry->Key != Key || Entry->VaryNames.Num() != Entry->VaryValues.Num())
+        return nullptr;
+
+    return Entry;
+}
+
+void FMasterHttpResponseCache::WriteToDisk(const FMasterHttpCacheEntryPtr& Entry)
+{
+    // Written on a worker so completions never wait on the disk
+    Async(EAsyncExecution::ThreadPool, [Entry]() {
+        TArray<uint8> Bytes;
+        FMemoryWriter Writer(Bytes);
+        int32 Version = MasterHttp::CacheFileVersion;
+        Writer << Version;
+        // Saving only reads the entry; FArchive just has no const overloads
+        SerializeEntry(Writer, const_cast<FMasterHttpCacheEntry&>(*Entry));
+        FFileHelper::SaveArrayToFile(Bytes, *GetDiskPath(Entry->Key));
+    });
+}
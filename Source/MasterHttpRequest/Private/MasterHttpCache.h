@@ -0,0 +1,87 @@
+/*
+==========================================================================================
+File: MasterHttpCache.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+#include "Interfaces/IHttpResponse.h"
+#include "MasterHttpRequestBPLibrary.h"
+
+/** A stored response plus what is needed to decide whether it can be reused. */
+struct FMasterHttpCacheEntry
+{
+    FString Key;
+    int32 StatusCode = 0;
+    FString ContentType;
+    TArray<FString> Headers;            // "Name: Value", as returned by IHttpResponse::GetAllHeaders
+    TArray<uint8> Content;
+
+    FString ETag;
+    FString LastModified;
+    TArray<FString> VaryNames;          // Request headers named by the response's Vary header
+    TArray<FString> VaryValues;         // Their values on the request that produced this entry
+    double ExpiresAtUtc = 0.0;          // Unix seconds; 0 means the entry must be revalidated before use
+
+    bool IsFresh() const;
+    bool HasValidators() const { return !ETag.IsEmpty() || !LastModified.IsEmpty(); }
+};
+
+using FMasterHttpCacheEntryPtr = TSharedPtr<const FMasterHttpCacheEntry, ESPMode::ThreadSafe>;
+
+/**
+ * Response cache keyed by method + final URL, honoring Cache-Control, Expires, ETag, Last-Modified and Vary.
+ * - Memory tier: an LRU of recent entries.
+ * - Disk tier (EHttpCachePolicy::MemoryAndDisk): one file per entry under Saved/MasterHttpCache, read on a memory miss.
+ * Fresh entries are served without a request; stale entries with validators turn the request into a conditional one
+ * and a 304 is answered from the entry. Owned by FMasterHttpRequestModule; safe to use from any thread.
+ */
+class FMasterHttpResponseCache
+{
+public:
+    explicit FMasterHttpResponseCache(int32 MaxMemoryEntries = 256);
+
+    /** Cache key for a request, or empty if requests with this method are never cached. */
+    static FString MakeKey(EHttpMethod Method, const FString& FinalURL);
+
+    /** Find a stored response whose Vary headers match Request. */
+    FMasterHttpCacheEntryPtr Find(const FString& Key, const FHttpRequestDescriptor& Request, EHttpCachePolicy Policy);
+
+    /** Store a response if its status and Cache-Control allow it. Returns the stored entry, or null. */
+    FMasterHttpCacheEntryPtr Store(const FString& Key, const FHttpRequestDescriptor& Request, const FHttpResponsePtr& Response, EHttpCachePolicy Policy);
+
+    /** Refresh an entry's lifetime from a 304 response. Returns the updated entry. */
+    FMasterHttpCacheEntryPtr Revalidate(const FMasterHttpCacheEntryPtr& Entry, const FHttpResponsePtr& NotModified, EHttpCachePolicy Policy);
+
+    /** Wrap an entry as an engine response so the rest of the pipeline treats it like a network response. */
+    static FHttpResponsePtr MakeCachedResponse(const FMasterHttpCacheEntryPtr& Entry, const FString& URL, const TCHAR* CacheStatus);
+
+    void RecordHit();
+    void RecordMiss();
+    void Clear(bool bIncludeDisk);
+    FHttpCacheStats GetStats() const;
+
+private:
+    /** Fill freshness and validators from response headers. Returns false if the response must not be stored. */
+    static bool ApplyCacheHeaders(FMasterHttpCacheEntry& Entry, const FHttpResponsePtr& Response);
+
+    static FString GetDiskDirectory();
+    static FString GetDiskPath(const FString& Key);
+    static void SerializeEntry(FArchive& Ar, FMasterHttpCacheEntry& Entry);
+
+    FMasterHttpCacheEntryPtr LoadFromDisk(const FString& Key);
+    void WriteToDisk(const FMasterHttpCacheEntryPtr& Entry);
+
+    mutable FCriticalSection Lock;
+    TLruCache<FString, FMasterHttpCacheEntryPtr> Memory;
+
+    int64 Hits = 0;
+    int64 Revalidated = 0;
+    int64 Misses = 0;
+    int64 DiskReads = 0;
+};
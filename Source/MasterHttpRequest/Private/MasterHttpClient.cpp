@@ -0,0 +1,653 @@
+/*
+==========================================================================================
+File: MasterHttpClient.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterHttpClient.h"
+#include "MasterHttpRequest.h"
+#include "MasterHttpRequestInternal.h"
+#include "MasterHttpScheduler.h"
+#include "MasterHttpCache.h"
+#include "MasterHttpCoalescer.h"
+#include "MasterHttpRetry.h"
+#include "MasterHttpHostGuard.h"
+#include "MasterHttpCompression.h"
+#include "MasterHttpMetrics.h"
+#include "MasterHttpTrace.h"
+#include "MasterHttpRequestRegistry.h"
+#include "Containers/Ticker.h"
+#include "Async/Async.h"
+#include "Interfaces/IHttpRequest.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include <atomic>
+
+namespace MasterHttp
+{
+    /** One request moving through the scheduler, kept alive across retry attempts. Attempts never overlap. */
+    struct FRequestRun
+    {
+        TSharedPtr<FMasterHttpScheduler, ESPMode::ThreadSafe> Scheduler;
+        TSharedPtr<FMasterHttpHostGuard, ESPMode::ThreadSafe> HostGuard;
+        TSharedPtr<FMasterHttpMetrics, ESPMode::ThreadSafe> Metrics;
+        FHttpRequestDescriptor Request;
+        FString Host;
+        int64 RequestId = 0;
+        int32 MaxPerHost = 0;
+        bool bCompleteOnHttpThread = false;
+        bool bDecodeOffGameThread = false;      // Engine completes on the HTTP thread; the result is moved to the game thread after decoding
+        int64 UncompressedBodyBytes = -1;
+        FMasterHttpNativeComplete OnComplete;
+        FMasterHttpConfigureRequest OnConfigure;
+
+        /** Cancellation and progress; null for coalesced leaders, whose call is shared and always runs to the end. */
+        TSharedPtr<FMasterHttpRequestState, ESPMode::ThreadSafe> State;
+        std::atomic<bool> bCompleted{false};    // Claimed by whichever path completes the request, so OnComplete runs once
+        std::atomic<bool> bHoldsProbe{false};   // Let through as the circuit's half-open probe and not reported yet
+
+        double FirstStartTime = 0.0;
+        double AttemptStartTime = 0.0;
+        double SubmitTime = 0.0;
+        double EnqueueTime = 0.0;               // When the current attempt started waiting for a token / slot
+        double FirstByteTime = 0.0;             // Response headers of the current attempt
+        double QueuedSeconds = 0.0;
+        float PendingDelaySeconds = 0.0f;
+        TArray<FHttpAttemptInfo> Attempts;
+    };
+
+    static void StartAttempt(const TSharedRef<FRequestRun, ESPMode::ThreadSafe>& Run);
+
+    /** Call OnComplete asynchronously on the requested thread: for local completions, and for results moved to the game thread after decoding. */
+    static void DispatchCompletion(bool bCompleteOnHttpThread, FMasterHttpNativeComplete OnComplete, FMasterHttpResult&& Result)
+    {
+        if (Result.CompletedTime == 0.0)
+        {
+            Result.CompletedTime = FPlatformTime::Seconds();
+        }
+        AsyncTask(bCompleteOnHttpThread ? ENamedThreads::AnyBackgroundThreadNormalTask : ENamedThreads::GameThread, [Result = MoveTemp(Result), OnComplete = MoveTemp(OnComplete)]() {
+            OnComplete(Result);
+        });
+    }
+
+    /** Complete a request that ends without a response (circuit open, cancelled), unless another path already completed it. */
+    static void CompleteLocally(const TSharedRef<FRequestRun, ESPMode::ThreadSafe>& Run, EHttpErrorKind Kind, FString Message)
+    {
+        if (Run->bCompleted.exchange(true))
+            return;
+
+        if (Run->bHoldsProbe.exchange(false))
+        {
+            Run->HostGuard->ReleaseProbe(Run->Host);
+        }
+
+        FMasterHttpResult Result;
+        Result.FinalURL = Run->Request.URL;
+        Result.StartTime = Run->FirstStartTime > 0.0 ? Run->FirstStartTime : FPlatformTime::Seconds();
+        Result.Attempts = MoveTemp(Run->Attempts);
+        Result.LocalError = Kind;
+        Result.LocalErrorMessage = MoveTemp(Message);
+        Result.SubmitTime = Run->SubmitTime;
+        Result.Timing.QueuedSeconds = static_cast<float>(Run->QueuedSeconds);
+        Result.RequestId = Run->RequestId;
+        Run->Metrics->Record(Run->Request.Method, Result);
+        EndRequestRegion(Run->RequestId);
+        DispatchCompletion(Run->bCompleteOnHttpThread, MoveTemp(Run->OnComplete), MoveTemp(Result));
+    }
+
+    /** True if the request must not go on: it was cancelled (and is completed here) or already completed. */
+    static bool StopIfCancelled(const TSharedRef<FRequestRun, ESPMode::ThreadSafe>& Run)
+    {
+        if (Run->bCompleted)
+            return true;
+
+        if (Run->State.IsValid() && Run->State->IsCancelRequested())
+        {
+            CompleteLocally(Run, EHttpErrorKind::Cancelled, TEXT("Request cancelled"));
+            return true;
+        }
+        return false;
+    }
+
+    /** Wait for a rate limiter token, then for a scheduler slot, then send the next attempt. */
+    static void ScheduleAttempt(const TSharedRef<FRequestRun, ESPMode::ThreadSafe>& Run)
+    {
+        if (StopIfCancelled(Run))
+            return;
+
+        const double TokenWait = Run->HostGuard->TryAcquireToken(Run->Host);
+        if (TokenWait > 0.0)
+        {
+            FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Run](float DeltaTime) {
+                ScheduleAttempt(Run);
+                return false;
+            }), static_cast<float>(TokenWait));
+            return;
+        }
+
+        FMasterHttpScheduledRequest Scheduled;
+        Scheduled.Host = Run->Host;
+        Scheduled.Priority = Run->Request.Options.Priority;
+        Scheduled.MaxPerHost = Run->MaxPerHost;
+        Scheduled.RequestId = Run->RequestId;
+        Scheduled.Start = [Run]() {
+            StartAttempt(Run);
+        };
+        Run->Scheduler->Enqueue(MoveTemp(Scheduled));
+    }
+
+    /** Start an attempt, unless the host's circuit is open, in which case the request fails fast without a slot. */
+    static void EnqueueRun(const TSharedRef<FRequestRun, ESPMode::ThreadSafe>& Run)
+    {
+        if (StopIfCancelled(Run))
+            return;
+
+        bool bProbe = false;
+        if (!Run->HostGuard->AllowRequest(Run->Host, bProbe))
+        {
+            CompleteLocally(Run, EHttpErrorKind::CircuitOpen, FString::Printf(TEXT("Circuit open for %s: the host is failing, request not sent"), *Run->Host));
+            return;
+        }
+        Run->bHoldsProbe = bProbe;
+
+        Run->EnqueueTime = FPlatformTime::Seconds();
+        ScheduleAttempt(Run);
+    }
+
+    static void FinishAttempt(const TSharedRef<FRequestRun, ESPMode::ThreadSafe>& Run, const FHttpResponsePtr& Response, bool bWasSuccessful, const FString& FinalURL, int64 BytesSent)
+    {
+        MASTERHTTP_SCOPE(FinishAttempt);
+
+        // Release the slot first, also while waiting to retry, so a backoff never holds up other requests
+        Run->Scheduler->OnRequestFinished(Run->Host, Run->Request.Options.Priority);
+
+        // A cancelled attempt says nothing about the host's health; a probe it held goes to the next request
+        if (StopIfCancelled(Run))
+            return;
+
+        Run->HostGuard->RecordResult(Run->Host, bWasSuccessful && Response.IsValid() && Response->GetResponseCode() < 500);
+        Run->bHoldsProbe = false;
+
+        FHttpAttemptInfo& Attempt = Run->Attempts.AddDefaulted_GetRef();
+        Attempt.StatusCode = Response.IsValid() ? Response->GetResponseCode() : -1;
+        Attempt.DurationSeconds = static_cast<float>(FPlatformTime::Seconds() - Run->AttemptStartTime);
+        Attempt.DelayBeforeSeconds = Run->PendingDelaySeconds;
+
+        float RetryDelay = 0.0f;
+        if (GetRetryDelay(Run->Request.Method, Run->Request.Options, Run->Attempts.Num(), Response, bWasSuccessful, RetryDelay))
+        {
+            if (Run->Request.Options.DebugLevel != EDebugLevel::None)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("🔁 HTTP Retry %d/%d in %.2fs: %s (status %d)"), Run->Attempts.Num() + 1, Run->Request.Options.MaxAttempts, RetryDelay, *FinalURL, Attempt.StatusCode);
+            }
+
+            Run->PendingDelaySeconds = RetryDelay;
+            if (Run->State.IsValid())
+            {
+                Run->State->EndAttempt();
+            }
+            FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Run](float DeltaTime) {
+                EnqueueRun(Run);
+                return false;
+            }), RetryDelay);
+            return;
+        }
+
+        FMasterHttpResult Result;
+        Result.Response = Response;
+        Result.bWasSuccessful = bWasSuccessful;
+        Result.FinalURL = FinalURL;
+        Result.StartTime = Run->FirstStartTime;
+        Result.SubmitTime = Run->SubmitTime;
+        Result.RequestId = Run->RequestId;
+
+        const double Now = FPlatformTime::Seconds();
+        FHttpTimingBreakdown& Timing = Result.Timing;
+        Timing.QueuedSeconds = static_cast<float>(Run->QueuedSeconds);
+        Timing.TimeToStartSeconds = static_cast<float>(Run->AttemptStartTime - Run->SubmitTime);
+        if (Run->FirstByteTime > 0.0)
+        {
+            Timing.TimeToFirstByteSeconds = static_cast<float>(Run->FirstByteTime - Run->AttemptStartTime);
+            Timing.DownloadSeconds = static_cast<float>(Now - Run->FirstByteTime);
+        }
+        for (const FHttpAttemptInfo& Info : Run->Attempts)
+        {
+            Timing.RetryDelaySeconds += Info.DelayBeforeSeconds;
+        }
+        Result.Attempts = MoveTemp(Run->Attempts);
+        Result.BytesSent = BytesSent;
+        Result.BytesSentUncompressed = Run->UncompressedBodyBytes;
+        if (Run->Request.Options.bDecompressResponses)
+        {
+            Result.Response = DecodeResponse(Response, Result.BytesReceived);
+        }
+
+        Result.CompletedTime = FPlatformTime::Seconds();
+        if (Run->bCompleted.exchange(true))
+            return;
+        Run->Metrics->Record(Run->Request.Method, Result);
+        EndRequestRegion(Run->RequestId);
+
+        if (Run->bDecodeOffGameThread)
+        {
+            DispatchCompletion(false, MoveTemp(Run->OnComplete), MoveTemp(Result));
+            return;
+        }
+        Run->OnComplete(Result);
+    }
+
+    static void StartAttempt(const TSharedRef<FRequestRun, ESPMode::ThreadSafe>& Run)
+    {
+        // Cancelled after the slot was granted: hand the slot straight back
+        if (StopIfCancelled(Run))
+        {
+            Run->Scheduler->OnRequestFinished(Run->Host, Run->Request.Options.Priority);
+            return;
+        }
+
+        // The request is built inline once the scheduler grants a slot: IHttpRequest is already asynchronous,
+        // so there is no need to hop through the task graph first.
+        Run->AttemptStartTime = FPlatformTime::Seconds();
+        Run->QueuedSeconds += Run->AttemptStartTime - Run->EnqueueTime;
+        Run->FirstByteTime = 0.0;
+        if (Run->Attempts.Num() == 0)
+        {
+            Run->FirstStartTime = Run->AttemptStartTime;
+        }
+
+        FString FinalURL;
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = BuildRequest(Run->Request, FinalURL);
+        if (Run->bCompleteOnHttpThread || Run->bDecodeOffGameThread)
+        {
+            HttpRequest->SetDelegateThreadPolicy(EHttpRequestDelegateThreadPolicy::CompleteOnHttpThread);
+        }
+
+        HttpRequest->OnProcessRequestComplete().BindLambda(
+            [Run, FinalURL = MoveTemp(FinalURL)](FHttpRequestPtr InRequest, FHttpResponsePtr Response, bool bWasSuccessful) {
+                FinishAttempt(Run, Response, bWasSuccessful, FinalURL, InRequest.IsValid() ? InRequest->GetContentLength() : 0);
+            });
+
+        // Headers arrive before the body, so the first one marks time to first byte (streamed transfers may rebind this)
+        HttpRequest->OnHeaderReceived().BindLambda([Run](FHttpRequestPtr InRequest, const FString& HeaderName, const FString& NewHeaderValue) {
+            if (Run->FirstByteTime == 0.0)
+            {
+                Run->FirstByteTime = FPlatformTime::Seconds();
+            }
+        });
+
+        if (Run->OnConfigure)
+        {
+            Run->OnConfigure(HttpRequest);
+        }
+
+        if (!Run->State.IsValid())
+        {
+            HttpRequest->ProcessRequest();
+            return;
+        }
+
+        // Track progress for the handle, forwarding to a progress delegate the configure hook may have bound
+        FHttpRequestProgressDelegate64 ConfiguredProgress = HttpRequest->OnRequestProgress64();
+        HttpRequest->OnRequestProgress64().BindLambda([State = Run->State, ConfiguredProgress](FHttpRequestPtr InRequest, uint64 BytesSent, uint64 BytesReceived) {
+            State->BytesSent = static_cast<int64>(BytesSent);
+            State->BytesReceived = static_cast<int64>(BytesReceived);
+            if (State->BytesExpected.load() == 0 && BytesReceived > 0 && InRequest.IsValid())
+            {
+                if (FHttpResponsePtr Response = InRequest->GetResponse())
+                {
+                    State->BytesExpected = FMath::Max<int64>(0, Response->GetContentLength());
+                }
+            }
+            ConfiguredProgress.ExecuteIfBound(InRequest, BytesSent, BytesReceived);
+        });
+
+        // Registered under the state's lock, so a concurrent Cancel either sees the engine request or stops it here
+        if (!Run->State->StartAttempt(HttpRequest, [&HttpRequest]() { HttpRequest->ProcessRequest(); }))
+        {
+            Run->Scheduler->OnRequestFinished(Run->Host, Run->Request.Options.Priority);
+            CompleteLocally(Run, EHttpErrorKind::Cancelled, TEXT("Request cancelled"));
+        }
+    }
+}
+
+UMasterHttpClient* UMasterHttpClient::CreateHttpClient(const FString& InBaseURL, FHttpOptions Options, int32 InMaxConnectionsPerHost)
+{
+    UMasterHttpClient* Client = NewObject<UMasterHttpClient>();
+    Client->BaseURL = InBaseURL;
+    Client->DefaultOptions = Options;
+    Client->MaxConnectionsPerHost = FMath::Max(1, InMaxConnectionsPerHost);
+    return Client;
+}
+
+UMasterHttpClient* UMasterHttpClient::GetDefaultHttpClient()
+{
+    return FMasterHttpRequestModule::Get().GetDefaultClient();
+}
+
+FHttpRequestHandle UMasterHttpClient::SendRequest(
+    const FString& Path,
+    EHttpMethod Method,
+    TArray<FHttpHeaderEnumValue> Headers,
+    TArray<FHttpKeyValue> CustomHeaders,
+    TArray<FHttpKeyValue> QueryParams,
+    TArray<FHttpKeyValue> Body,
+    FHttpResponseDelegate Callback)
+{
+    FHttpRequestDescriptor Request;
+    Request.URL = Path;
+    Request.Method = Method;
+    Request.DefaultHeaders = MoveTemp(Headers);
+    Request.CustomHeaders = MoveTemp(CustomHeaders);
+    Request.QueryParams = MoveTemp(QueryParams);
+    Request.Body = MoveTemp(Body);
+    Request.Options = DefaultOptions;
+    return SendRequestDescriptor(Request, Callback);
+}
+
+FHttpRequestHandle UMasterHttpClient::SendRequestDescriptor(const FHttpRequestDescriptor& Request, FHttpResponseDelegate Callback)
+{
+    return ProcessRequest(Request, false, MakeDelegateCompletion(Request, Callback));
+}
+
+FMasterHttpNativeComplete UMasterHttpClient::MakeDelegateCompletion(const FHttpRequestDescriptor& Request, FHttpResponseDelegate Callback)
+{
+    return MakeNativeCompletion(Request, [Callback = MoveTemp(Callback)](FHttpResponseSimple&& Response) {
+        // Moved into the call; the generated wrapper still copies it once into the delegate's parameters
+        Callback.ExecuteIfBound(MoveTemp(Response));
+    });
+}
+
+FMasterHttpNativeComplete UMasterHttpClient::MakeNativeCompletion(const FHttpRequestDescriptor& Request, TFunction<void(FHttpResponseSimple&&)> OnResponse)
+{
+    // Only keep a copy of the request around when it is going to be logged
+    TSharedPtr<const FHttpRequestDescriptor, ESPMode::ThreadSafe> DebugRequest;
+    if (Request.Options.DebugLevel != EDebugLevel::None)
+    {
+        DebugRequest = MakeShared<const FHttpRequestDescriptor, ESPMode::ThreadSafe>(Request);
+    }
+
+    return [DebugRequest, BodyMode = MasterHttp::GetResponseBodyMode(Request.Options), bSplitHeaders = Request.Options.bSplitResponseHeaders, OnResponse = MoveTemp(OnResponse)](const FMasterHttpResult& Result) {
+        FHttpResponseSimple RespData = MasterHttp::MakeResponse(Result, BodyMode, bSplitHeaders);
+
+        // Enhanced debug logging
+        if (DebugRequest.IsValid())
+        {
+            UMasterHttpRequestBPLibrary::LogDebugInfo(Result.FinalURL, DebugRequest->Method, DebugRequest->QueryParams, DebugRequest->CustomHeaders, DebugRequest->Body, RespData, DebugRequest->Options);
+        }
+
+        OnResponse(MoveTemp(RespData));
+    };
+}
+
+TFuture<FHttpResponseSimple> UMasterHttpClient::SendAsync(FHttpRequestDescriptor Request, FHttpRequestHandle* OutHandle)
+{
+    TSharedRef<TPromise<FHttpResponseSimple>, ESPMode::ThreadSafe> Promise = MakeShared<TPromise<FHttpResponseSimple>, ESPMode::ThreadSafe>();
+    TFuture<FHttpResponseSimple> Future = Promise->GetFuture();
+
+    FMasterHttpNativeComplete OnComplete = MakeNativeCompletion(Request, [Promise](FHttpResponseSimple&& Response) {
+        Promise->SetValue(MoveTemp(Response));
+    });
+
+    // Completing on the HTTP thread keeps the whole chain off the game thread
+    FHttpRequestHandle Handle = ProcessRequest(MoveTemp(Request), true, MoveTemp(OnComplete));
+    if (OutHandle)
+    {
+        *OutHandle = MoveTemp(Handle);
+    }
+    return Future;
+}
+
+TFuture<FHttpResponseSimple> UMasterHttpClient::SendAfter(TFuture<FHttpResponseSimple>&& Previous, TFunction<TOptional<FHttpRequestDescriptor>(const FHttpResponseSimple&)> Next)
+{
+    TSharedRef<TPromise<FHttpResponseSimple>, ESPMode::ThreadSafe> Promise = MakeShared<TPromise<FHttpResponseSimple>, ESPMode::ThreadSafe>();
+    TFuture<FHttpResponseSimple> Future = Promise->GetFuture();
+
+    // Copied now, so the chain never reads the UObject from the thread that completes Previous
+    Previous.Next([Settings = GetSettings(), Promise, Next = MoveTemp(Next)](FHttpResponseSimple Response) {
+        TOptional<FHttpRequestDescriptor> NextRequest;
+        if (Response.bSuccess)
+        {
+            NextRequest = Next(Response);
+        }
+        if (!NextRequest.IsSet())
+        {
+            Promise->SetValue(MoveTemp(Response));
+            return;
+        }
+
+        FMasterHttpNativeComplete OnComplete = MakeNativeCompletion(NextRequest.GetValue(), [Promise](FHttpResponseSimple&& NextResponse) {
+            Promise->SetValue(MoveTemp(NextResponse));
+        });
+        ProcessRequest(Settings, MoveTemp(NextRequest.GetValue()), true, MoveTemp(OnComplete));
+    });
+    return Future;
+}
+
+int32 UMasterHttpClient::GetActiveRequestCount(const FString& Host) const
+{
+    return FMasterHttpRequestModule::Get().GetScheduler()->GetActiveRequestCount(Host);
+}
+
+int32 UMasterHttpClient::GetPendingRequestCount(const FString& Host) const
+{
+    return FMasterHttpRequestModule::Get().GetScheduler()->GetQueuedRequestCount(Host);
+}
+
+bool UMasterHttpClient::ApplyResponseCache(FHttpRequestDescriptor& Request, int64 RequestId, bool bCompleteOnHttpThread, FMasterHttpNativeComplete& OnComplete)
+{
+    MASTERHTTP_SCOPE(CacheLookup);
+
+    FString FinalURL;
+    MasterHttp::BuildFinalURL(Request, FinalURL);
+    FString CacheKey = FMasterHttpResponseCache::MakeKey(Request.Method, FinalURL);
+    if (CacheKey.IsEmpty())
+        return true;
+
+    const EHttpCachePolicy CachePolicy = Request.Options.CachePolicy;
+    TSharedRef<FMasterHttpResponseCache, ESPMode::ThreadSafe> Cache = FMasterHttpRequestModule::Get().GetResponseCache();
+    FMasterHttpCacheEntryPtr Entry = Cache->Find(CacheKey, Request, CachePolicy);
+
+    // Fresh entries never reach the scheduler; completion stays asynchronous so callers see the same ordering either way
+    if (Entry.IsValid() && Entry->IsFresh())
+    {
+        Cache->RecordHit();
+        FMasterHttpResult Result;
+        Result.Response = FMasterHttpResponseCache::MakeCachedResponse(Entry, FinalURL, TEXT("HIT"));
+        Result.bWasSuccessful = true;
+        Result.FinalURL = MoveTemp(FinalURL);
+        Result.StartTime = FPlatformTime::Seconds();
+        Result.SubmitTime = Result.StartTime;
+        Result.RequestId = RequestId;
+        FMasterHttpRequestModule::Get().GetMetrics()->Record(Request.Method, Result);
+        MasterHttp::DispatchCompletion(bCompleteOnHttpThread, MoveTemp(OnComplete), MoveTemp(Result));
+        return false;
+    }
+
+    Cache->RecordMiss();
+    if (Entry.IsValid())
+    {
+        if (!Entry->ETag.IsEmpty())
+        {
+            Request.CustomHeaders.Add(UMasterHttpRequestBPLibrary::MakeKeyValue(TEXT("If-None-Match"), Entry->ETag));
+        }
+        if (!Entry->LastModified.IsEmpty())
+        {
+            Request.CustomHeaders.Add(UMasterHttpRequestBPLibrary::MakeKeyValue(TEXT("If-Modified-Since"), Entry->LastModified));
+        }
+    }
+
+    // Vary values are read from the request when the response is stored
+    TSharedRef<const FHttpRequestDescriptor, ESPMode::ThreadSafe> CacheRequest = MakeShared<const FHttpRequestDescriptor, ESPMode::ThreadSafe>(Request);
+    OnComplete = [Cache, CacheKey = MoveTemp(CacheKey), CachePolicy, Entry, CacheRequest, OnComplete = MoveTemp(OnComplete)](const FMasterHttpResult& Result) {
+        const FHttpResponsePtr& Response = Result.Response;
+        if (Result.bWasSuccessful && Entry.IsValid() && Response.IsValid() && Response->GetResponseCode() == EHttpResponseCodes::NotModified)
+        {
+            FMasterHttpResult Revalidated = Result;
+            Revalidated.Response = FMasterHttpResponseCache::MakeCachedResponse(Cache->Revalidate(Entry, Response, CachePolicy), Result.FinalURL, TEXT("REVALIDATED"));
+            OnComplete(Revalidated);
+            return;
+        }
+
+        if (Result.bWasSuccessful)
+        {
+            Cache->Store(CacheKey, *CacheRequest, Response, CachePolicy);
+        }
+        OnComplete(Result);
+    };
+    return true;
+}
+
+FString UMasterHttpClient::ResolveURL(const FString& Path) const
+{
+    return ResolveURL(BaseURL, Path);
+}
+
+FString UMasterHttpClient::ResolveURL(const FString& InBaseURL, const FString& Path)
+{
+    if (InBaseURL.IsEmpty() || Path.StartsWith(TEXT("http://")) || Path.StartsWith(TEXT("https://")))
+        return Path;
+
+    if (Path.IsEmpty())
+        return InBaseURL;
+
+    const bool bBaseHasSlash = InBaseURL.EndsWith(TEXT("/"));
+    const bool bPathHasSlash = Path.StartsWith(TEXT("/"));
+    if (bBaseHasSlash && bPathHasSlash)
+        return InBaseURL + Path.RightChop(1);
+    if (bBaseHasSlash || bPathHasSlash)
+        return InBaseURL + Path;
+    return InBaseURL + TEXT("/") + Path;
+}
+
+FMasterHttpClientSettings UMasterHttpClient::GetSettings() const
+{
+    FMasterHttpClientSettings Settings;
+    Settings.BaseURL = BaseURL;
+    Settings.DefaultHeaders = DefaultHeaders;
+    Settings.DefaultCustomHeaders = DefaultCustomHeaders;
+    Settings.MaxConnectionsPerHost = MaxConnectionsPerHost;
+    return Settings;
+}
+
+FHttpRequestHandle UMasterHttpClient::ProcessRequest(FHttpRequestDescriptor Request, bool bCompleteOnHttpThread, FMasterHttpNativeComplete OnComplete, FMasterHttpConfigureRequest OnConfigure)
+{
+    return ProcessRequestWith(BaseURL, DefaultHeaders, DefaultCustomHeaders, MaxConnectionsPerHost, MoveTemp(Request), bCompleteOnHttpThread, MoveTemp(OnComplete), MoveTemp(OnConfigure));
+}
+
+FHttpRequestHandle UMasterHttpClient::ProcessRequest(const FMasterHttpClientSettings& Settings, FHttpRequestDescriptor Request, bool bCompleteOnHttpThread, FMasterHttpNativeComplete OnComplete, FMasterHttpConfigureRequest OnConfigure)
+{
+    return ProcessRequestWith(Settings.BaseURL, Settings.DefaultHeaders, Settings.DefaultCustomHeaders, Settings.MaxConnectionsPerHost, MoveTemp(Request), bCompleteOnHttpThread, MoveTemp(OnComplete), MoveTemp(OnConfigure));
+}
+
+FHttpRequestHandle UMasterHttpClient::ProcessRequestWith(const FString& InBaseURL, const TArray<FHttpHeaderEnumValue>& InDefaultHeaders, const TArray<FHttpKeyValue>& InDefaultCustomHeaders, int32 InMaxConnectionsPerHost,
+    FHttpRequestDescriptor Request, bool bCompleteOnHttpThread, FMasterHttpNativeComplete OnComplete, FMasterHttpConfigureRequest OnConfigure)
+{
+    MASTERHTTP_SCOPE(Submit);
+    const int64 RequestId = MasterHttp::AllocateRequestId();
+
+    // Every path below ends in OnComplete, so the request leaves the registry there, reporting Cancelled if it was cancelled first
+    TSharedRef<FMasterHttpRequestRegistry, ESPMode::ThreadSafe> Registry = FMasterHttpRequestModule::Get().GetRequestRegistry();
+    FMasterHttpRequestStateRef State = Registry->Register(RequestId, Request.Options.Tag);
+    OnComplete = [Registry, State, OnComplete = MoveTemp(OnComplete)](const FMasterHttpResult& Result) {
+        const bool bSucceeded = Result.bWasSuccessful && Result.Response.IsValid() && EHttpResponseCodes::IsOk(Result.Response->GetResponseCode());
+        const bool bCancelled = State->Finish(bSucceeded);
+        Registry->Unregister(State->RequestId);
+        if (!bCancelled)
+        {
+            OnComplete(Result);
+            return;
+        }
+
+        FMasterHttpResult Cancelled = Result;
+        Cancelled.Response = nullptr;
+        Cancelled.bWasSuccessful = false;
+        Cancelled.LocalError = EHttpErrorKind::Cancelled;
+        Cancelled.LocalErrorMessage = TEXT("Request cancelled");
+        OnComplete(Cancelled);
+    };
+
+    FHttpRequestHandle Handle;
+    Handle.RequestId = RequestId;
+    Handle.State = State;
+
+    // Merge client defaults in front of the request's own headers so the request can override them
+    Request.URL = ResolveURL(InBaseURL, Request.URL);
+    if (InDefaultHeaders.Num() > 0)
+    {
+        Request.DefaultHeaders.Insert(InDefaultHeaders, 0);
+    }
+    if (InDefaultCustomHeaders.Num() > 0)
+    {
+        Request.CustomHeaders.Insert(InDefaultCustomHeaders, 0);
+    }
+
+    // Identical GETs already in flight share one call; the leader then goes through the cache like any other request.
+    // Requests with a configure hook (streamed transfers) own their engine request and are never shared.
+    // Cancelling a shared request only changes its own callback: the call keeps running for the others.
+    bool bShared = false;
+    if (Request.Options.bCoalesceInFlight && !OnConfigure)
+    {
+        const FString CoalesceKey = FMasterHttpCoalescer::MakeKey(Request, bCompleteOnHttpThread);
+        if (!CoalesceKey.IsEmpty())
+        {
+            if (FMasterHttpRequestModule::Get().GetCoalescer()->JoinOrLead(CoalesceKey, OnComplete))
+            {
+                return Handle;
+            }
+            bShared = true;
+        }
+    }
+
+    if (Request.Options.CachePolicy != EHttpCachePolicy::None && !ApplyResponseCache(Request, RequestId, bCompleteOnHttpThread, OnComplete))
+    {
+        return Handle;
+    }
+
+    TSharedRef<MasterHttp::FRequestRun, ESPMode::ThreadSafe> Run = MakeShared<MasterHttp::FRequestRun, ESPMode::ThreadSafe>();
+    Run->Scheduler = FMasterHttpRequestModule::Get().GetScheduler();
+    Run->HostGuard = FMasterHttpRequestModule::Get().GetHostGuard();
+    Run->Metrics = FMasterHttpRequestModule::Get().GetMetrics();
+    Run->Host = FGenericPlatformHttp::GetUrlDomain(Request.URL);
+    Run->MaxPerHost = InMaxConnectionsPerHost;
+    Run->SubmitTime = FPlatformTime::Seconds();
+    Run->RequestId = RequestId;
+    Run->bCompleteOnHttpThread = bCompleteOnHttpThread;
+    Run->OnComplete = MoveTemp(OnComplete);
+    Run->OnConfigure = MoveTemp(OnConfigure);
+    Run->Request = MoveTemp(Request);
+    if (!bShared)
+    {
+        Run->State = State;
+    }
+
+    // Streamed transfers keep per-request state in their configure hook, so they are never replayed, and their
+    // progress delegates stay on the game thread
+    if (Run->OnConfigure)
+    {
+        Run->Request.Options.MaxAttempts = 1;
+    }
+    else
+    {
+        MasterHttp::CompressRequestBody(Run->Request, Run->UncompressedBodyBytes);
+        Run->bDecodeOffGameThread = !bCompleteOnHttpThread && Run->Request.Options.bDecompressResponses;
+    }
+
+    MasterHttp::BeginRequestRegion(RequestId, Run->Request.Method, Run->Request.URL);
+
+    // Not on the wire yet: take it out of the scheduler's queue (or stop it at its next stage) and complete it now.
+    // Weak, so a finished run is not kept alive by its handle.
+    if (Run->State.IsValid())
+    {
+        State->SetOnCancel([WeakRun = TWeakPtr<MasterHttp::FRequestRun, ESPMode::ThreadSafe>(Run)]() {
+            if (TSharedPtr<MasterHttp::FRequestRun, ESPMode::ThreadSafe> PinnedRun = WeakRun.Pin())
+            {
+                PinnedRun->Scheduler->Remove(PinnedRun->RequestId);
+                MasterHttp::CompleteLocally(PinnedRun.ToSharedRef(), EHttpErrorKind::Cancelled, TEXT("Request cancelled"));
+            }
+        });
+    }
+
+    MasterHttp::EnqueueRun(Run);
+    return Handle;
+}
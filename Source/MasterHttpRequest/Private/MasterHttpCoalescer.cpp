@@ -0,0 +1,81 @@
+/*
+==========================================================================================
+File: MasterHttpCoalescer.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterHttpCoalescer.h"
+#include "MasterHttpRequest.h"
+#include "MasterHttpRequestInternal.h"
+
+FString FMasterHttpCoalescer::MakeKey(const FHttpRequestDescriptor& Request, bool bCompleteOnHttpThread)
+{
+    // Only reads are shared; two POSTs are two separate actions even when their bodies match
+    if (Request.Method != EHttpMethod::GET)
+        return FString();
+
+    FString Key;
+    MasterHttp::BuildFinalURL(Request, Key);
+    Key.AppendChar(bCompleteOnHttpThread ? TEXT('H') : TEXT('G'));
+
+    // Headers such as Authorization change the response, so they are part of the identity
+    for (const FHttpHeaderEnumValue& H : Request.DefaultHeaders)
+    {
+        Key.AppendChar(TEXT('\n'));
+        Key += H.Key == EHttpHeaderKey::Custom ? H.CustomKey : FString(MasterHttp::GetHeaderKeyString(H.Key));
+        Key.AppendChar(TEXT(':'));
+        Key += H.Value;
+    }
+    for (const FHttpKeyValue& H : Request.CustomHeaders)
+    {
+        Key.AppendChar(TEXT('\n'));
+        Key += H.Key;
+        Key.AppendChar(TEXT(':'));
+        Key += H.Value;
+    }
+    return Key;
+}
+
+bool FMasterHttpCoalescer::JoinOrLead(const FString& Key, FMasterHttpNativeComplete& OnComplete)
+{
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (TArray<FMasterHttpNativeComplete>* Waiters = InFlight.Find(Key))
+        {
+            Waiters->Add(MoveTemp(OnComplete));
+            ++CoalescedCount;
+            return true;
+        }
+        InFlight.Add(Key);
+    }
+
+    // The module owns the coalescer; hold a reference so late completions never touch a destroyed instance
+    TSharedRef<FMasterHttpCoalescer, ESPMode::ThreadSafe> Coalescer = FMasterHttpRequestModule::Get().GetCoalescer();
+    OnComplete = [Coalescer, Key, OnComplete = MoveTemp(OnComplete)](const FMasterHttpResult& Result) {
+        // Requests joining after this point start a new network call instead of reading a finished one
+        TArray<FMasterHttpNativeComplete> Waiters = Coalescer->TakeWaiters(Key);
+
+        OnComplete(Result);
+        for (const FMasterHttpNativeComplete& Waiter : Waiters)
+        {
+            Waiter(Result);
+        }
+    };
+    return false;
+}
+
+TArray<FMasterHttpNativeComplete> FMasterHttpCoalescer::TakeWaiters(const FString& Key)
+{
+    FScopeLock ScopeLock(&Lock);
+    TArray<FMasterHttpNativeComplete> Waiters;
+    InFlight.RemoveAndCopyValue(Key, Waiters);
+    return Waiters;
+}
+
+int64 FMasterHttpCoalescer::GetCoalescedCount() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return CoalescedCount;
+}
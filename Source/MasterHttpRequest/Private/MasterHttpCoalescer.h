@@ -0,0 +1,42 @@
+/*
+==========================================================================================
+File: MasterHttpCoalescer.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MasterHttpClient.h"
+
+/**
+ * Shares one network call between identical GET requests that are in flight at the same time.
+ * The first request (the leader) is sent; identical requests issued before it completes wait on it
+ * and receive the same engine response. Owned by FMasterHttpRequestModule; safe to use from any thread.
+ */
+class FMasterHttpCoalescer
+{
+public:
+    /** Identity of a request: method, final URL, headers and completion thread. Empty if the request must not be shared. */
+    static FString MakeKey(const FHttpRequestDescriptor& Request, bool bCompleteOnHttpThread);
+
+    /**
+    * Join an in-flight request with the same key, or become its leader.
+    * @return True if OnComplete was queued behind an in-flight request and nothing must be sent.
+    *         False if this request leads; OnComplete is then wrapped to fan the response out to later joiners.
+    */
+    bool JoinOrLead(const FString& Key, FMasterHttpNativeComplete& OnComplete);
+
+    /** Total number of requests that were answered by another request's network call. */
+    int64 GetCoalescedCount() const;
+
+private:
+    /** Remove the key and return the requests waiting on it. */
+    TArray<FMasterHttpNativeComplete> TakeWaiters(const FString& Key);
+
+    mutable FCriticalSection Lock;
+    TMap<FString, TArray<FMasterHttpNativeComplete>> InFlight;
+    int64 CoalescedCount = 0;
+};
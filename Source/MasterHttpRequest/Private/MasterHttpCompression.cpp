@@ -0,0 +1,195 @@
+/*
+==========================================================================================
+File: MasterHttpCompression.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterHttpCompression.h"
+#include "MasterHttpRequestInternal.h"
+#include "MasterHttpTrace.h"
+#include "Misc/Compression.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+namespace MasterHttp
+{
+    /** A response whose body was decoded by the plugin. Everything but the body and its encoding headers comes from the original. */
+    class FDecodedHttpResponse final : public IHttpResponse
+    {
+    public:
+        FDecodedHttpResponse(const FHttpResponsePtr& InInner, TArray<uint8>&& InContent)
+            : Inner(InInner)
+            , Content(MoveTemp(InContent))
+        {
+        }
+
+        virtual const FString& GetURL() const override { return Inner->GetURL(); }
+        virtual const FString& GetEffectiveURL() const override { return Inner->GetEffectiveURL(); }
+        virtual FString GetURLParameter(const FString& ParameterName) const override { return Inner->GetURLParameter(ParameterName); }
+        virtual EHttpRequestStatus::Type GetStatus() const override { return Inner->GetStatus(); }
+        virtual EHttpFailureReason GetFailureReason() const override { return Inner->GetFailureReason(); }
+
+        virtual FString GetHeader(const FString& HeaderName) const override
+        {
+            if (HeaderName.Equals(TEXT("Content-Encoding"), ESearchCase::IgnoreCase))
+                return FString();
+            if (HeaderName.Equals(TEXT("Content-Length"), ESearchCase::IgnoreCase))
+                return FString::FromInt(Content.Num());
+            return Inner->GetHeader(HeaderName);
+        }
+
+        /** Built on request only; most callers use GetHeader. */
+        virtual TArray<FString> GetAllHeaders() const override
+        {
+            TArray<FString> Headers = Inner->GetAllHeaders();
+            // The body no longer matches the original encoding and length
+            Headers.RemoveAll([](const FString& Header)
+            {
+                return Header.StartsWith(TEXT("Content-Encoding:"), ESearchCase::IgnoreCase) || Header.StartsWith(TEXT("Content-Length:"), ESearchCase::IgnoreCase);
+            });
+            Headers.Add(FString::Printf(TEXT("Content-Length: %d"), Content.Num()));
+            return Headers;
+        }
+
+        virtual FString GetContentType() const override { return Inner->GetContentType(); }
+        virtual uint64 GetContentLength() const override { return Content.Num(); }
+        virtual const TArray<uint8>& GetContent() const override { return Content; }
+        virtual int32 GetResponseCode() const override { return Inner->GetResponseCode(); }
+
+        virtual FString GetContentAsString() const override
+        {
+            FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Content.GetData()), Content.Num());
+            return FString::ConstructFromPtrSize(Converted.Get(), Converted.Length());
+        }
+
+        virtual FUtf8StringView GetContentAsUtf8StringView() const override
+        {
+            return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Content.GetData()), Content.Num());
+        }
+
+    private:
+        FHttpResponsePtr Inner;
+        TArray<uint8> Content;
+    };
+
+    /** zlib inflate with an unknown output size, accepting both gzip and zlib headers. */
+    static bool Inflate(const TArray<uint8>& In, TArray<uint8>& Out)
+    {
+        z_stream Stream;
+        FMemory::Memzero(Stream);
+        if (inflateInit2(&Stream, 15 + 32) != Z_OK)
+            return false;
+
+        Out.Reset(In.Num() * 4);
+        Stream.next_in = const_cast<Bytef*>(In.GetData());
+        Stream.avail_in = In.Num();
+
+        int Status = Z_OK;
+        while (Status == Z_OK)
+        {
+            if (Out.Num() == Out.Max())
+            {
+                Out.Reserve(FMath::Max(Out.Max() * 2, 4096));
+            }
+            const int32 Offset = Out.Num();
+            const int32 Available = Out.Max() - Offset;
+            Out.AddUninitialized(Available);
+            Stream.next_out = Out.GetData() + Offset;
+            Stream.avail_out = Available;
+
+            Status = inflate(&Stream, Z_NO_FLUSH);
+            Out.SetNum(Offset + Available - Stream.avail_out, EAllowShrinking::No);
+        }
+
+        inflateEnd(&Stream);
+        return Status == Z_STREAM_END;
+    }
+}
+
+void MasterHttp::CompressRequestBody(FHttpRequestDescriptor& Request, int64& OutUncompressedBytes)
+{
+    OutUncompressedBytes = -1;
+    const FHttpOptions& Options = Request.Options;
+    if (!Options.bCompressRequestBody || !MethodHasBody(Request.Method) || !FindRequestHeader(Request, TEXT("Content-Encoding")).IsEmpty())
+        return;
+
+    MASTERHTTP_SCOPE(CompressBody);
+
+    // Serialize the body once here so retries resend the same compressed bytes
+    TArray<uint8> Body;
+    if (Request.BinaryBody.Num() > 0)
+    {
+        Body = MoveTemp(Request.BinaryBody);
+    }
+    else
+    {
+        FTCHARToUTF8 Utf8(*BuildBodyString(Request));
+        Body.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+    }
+
+    if (Body.Num() >= Options.CompressionThresholdBytes)
+    {
+        int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Gzip, Body.Num());
+        TArray<uint8> Compressed;
+        Compressed.SetNumUninitialized(CompressedSize);
+        if (FCompression::CompressMemory(NAME_Gzip, Compressed.GetData(), CompressedSize, Body.GetData(), Body.Num()) && CompressedSize < Body.Num())
+        {
+            Compressed.SetNum(CompressedSize);
+            OutUncompressedBytes = Body.Num();
+            Request.BinaryBody = MoveTemp(Compressed);
+            Request.CustomHeaders.Add(UMasterHttpRequestBPLibrary::MakeKeyValue(TEXT("Content-Encoding"), TEXT("gzip")));
+            return;
+        }
+    }
+
+    Request.BinaryBody = MoveTemp(Body);
+}
+
+FHttpResponsePtr MasterHttp::DecodeResponse(const FHttpResponsePtr& Response, int64& OutWireBytes)
+{
+    OutWireBytes = -1;
+    if (!Response.IsValid())
+        return Response;
+
+    const TArray<uint8>& Content = Response->GetContent();
+    OutWireBytes = Content.Num();
+
+    const FString Encoding = Response->GetHeader(TEXT("Content-Encoding")).TrimStartAndEnd();
+    if (Encoding.IsEmpty() || Encoding.Equals(TEXT("identity"), ESearchCase::IgnoreCase))
+        return Response;
+
+    const bool bGzip = Encoding.Equals(TEXT("gzip"), ESearchCase::IgnoreCase) || Encoding.Equals(TEXT("x-gzip"), ESearchCase::IgnoreCase);
+    const bool bDeflate = Encoding.Equals(TEXT("deflate"), ESearchCase::IgnoreCase);
+
+    // Most platform HTTP layers decode transparently and leave the header in place; the gzip magic / zlib header tells
+    // whether the bytes are still encoded. Content-Length then still describes the encoded size on the wire.
+    const bool bStillGzip = bGzip && Content.Num() >= 2 && Content[0] == 0x1f && Content[1] == 0x8b;
+    const bool bStillZlib = bDeflate && Content.Num() >= 2 && (Content[0] & 0x0f) == 8 && ((Content[0] << 8) | Content[1]) % 31 == 0;
+    if (!bStillGzip && !bStillZlib)
+    {
+        const int64 HeaderLength = FCString::Atoi64(*Response->GetHeader(TEXT("Content-Length")));
+        if (HeaderLength > 0)
+        {
+            OutWireBytes = HeaderLength;
+        }
+        return Response;
+    }
+
+    TArray<uint8> Decoded;
+    bool bInflated;
+    {
+        MASTERHTTP_SCOPE(DecodeResponse);
+        bInflated = Inflate(Content, Decoded);
+    }
+    if (!bInflated)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("⚠️ HTTP Failed to decode %s response body from %s"), *Encoding, *Response->GetURL());
+        return Response;
+    }
+
+    return MakeShared<FDecodedHttpResponse, ESPMode::ThreadSafe>(Response, MoveTemp(Decoded));
+}
@@ -0,0 +1,31 @@
+/*
+==========================================================================================
+File: MasterHttpCompression.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpResponse.h"
+#include "MasterHttpRequestBPLibrary.h"
+
+/** gzip request bodies and gzip / deflate response decoding (internal use). */
+namespace MasterHttp
+{
+    /**
+    * Replace the request body with its gzip encoding and add "Content-Encoding: gzip", if Options.bCompressRequestBody is set,
+    * the body is at least CompressionThresholdBytes and compressing actually makes it smaller.
+    * @param OutUncompressedBytes - Body size before compression, or -1 if the body was left as-is.
+    */
+    void CompressRequestBody(FHttpRequestDescriptor& Request, int64& OutUncompressedBytes);
+
+    /**
+    * Decode a response body that is still gzip / deflate encoded (platform HTTP layers usually decode it already).
+    * Returns a response exposing the decoded body, or Response itself when there was nothing to decode.
+    * @param OutWireBytes - Body size as received: the encoded size when the response was compressed.
+    */
+    FHttpResponsePtr DecodeResponse(const FHttpResponsePtr& Response, int64& OutWireBytes);
+}
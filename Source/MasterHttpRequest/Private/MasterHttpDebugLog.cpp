@@ -0,0 +1,326 @@
+/*
+==========================================================================================
+File: MasterHttpDebugLog.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterHttpDebugLog.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/FileManager.h"
+#include "HAL/Event.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+namespace MasterHttp
+{
+    /** Records waiting beyond this are dropped rather than letting a stalled disk grow memory without bound. */
+    static constexpr int32 MaxQueuedRecords = 10000;
+
+    static FString GetDebugLogPath(EHttpDebugLogFormat Format, int32 Index)
+    {
+        const TCHAR* Extension = Format == EHttpDebugLogFormat::Ndjson ? TEXT("ndjson") : TEXT("log");
+        const FString Name = Index == 0 ? FString::Printf(TEXT("MasterHttp.%s"), Extension) : FString::Printf(TEXT("MasterHttp.%d.%s"), Index, Extension);
+        return FPaths::ProjectSavedDir() / TEXT("MasterHttpDebug") / Name;
+    }
+
+    static void AppendPairs(FStringBuilderBase& Out, const TCHAR* Title, const TArray<FHttpKeyValue>& Pairs, const TCHAR* Separator)
+    {
+        if (Pairs.Num() == 0)
+            return;
+
+        Out << Title << TEXT("\n");
+        for (const FHttpKeyValue& Pair : Pairs)
+        {
+            Out << TEXT("   ") << Pair.Key << Separator << Pair.Value << TEXT("\n");
+        }
+        Out << TEXT("\n");
+    }
+
+    static void WriteJsonPairs(TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>& Writer, const TCHAR* Name, const TArray<FHttpKeyValue>& Pairs)
+    {
+        if (Pairs.Num() == 0)
+            return;
+
+        Writer.WriteObjectStart(Name);
+        for (const FHttpKeyValue& Pair : Pairs)
+        {
+            Writer.WriteValue(Pair.Key, Pair.Value);
+        }
+        Writer.WriteObjectEnd();
+    }
+}
+
+FMasterHttpDebugLog::~FMasterHttpDebugLog()
+{
+    Shutdown();
+}
+
+void FMasterHttpDebugLog::Enqueue(TUniquePtr<FMasterHttpDebugRecord> Record)
+{
+    if (bStopping)
+        return;
+
+    if (QueuedCount.fetch_add(1) >= MasterHttp::MaxQueuedRecords)
+    {
+        QueuedCount.fetch_sub(1);
+        DroppedCount.fetch_add(1);
+        return;
+    }
+
+    Queue.Enqueue(MoveTemp(Record));
+    EnsureThread();
+    if (WakeEvent)
+    {
+        WakeEvent->Trigger();
+    }
+}
+
+void FMasterHttpDebugLog::SetSettings(EHttpDebugLogFormat InFormat, int64 InMaxFileBytes, int32 InMaxFiles)
+{
+    FScopeLock ScopeLock(&SettingsLock);
+    Format = InFormat;
+    MaxFileBytes = FMath::Max<int64>(InMaxFileBytes, 64 * 1024);
+    MaxFiles = FMath::Max(1, InMaxFiles);
+}
+
+FString FMasterHttpDebugLog::GetLogFilePath() const
+{
+    FScopeLock ScopeLock(&SettingsLock);
+    return MasterHttp::GetDebugLogPath(Format, 0);
+}
+
+void FMasterHttpDebugLog::Shutdown()
+{
+    bStopping = true;
+
+    FScopeLock ScopeLock(&ThreadLock);
+    if (Thread)
+    {
+        // Run() drains the queue once more before returning
+        Thread->Kill(true);
+        delete Thread;
+        Thread = nullptr;
+    }
+    if (WakeEvent)
+    {
+        FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+        WakeEvent = nullptr;
+    }
+}
+
+uint32 FMasterHttpDebugLog::Run()
+{
+    while (!bStopping)
+    {
+        WakeEvent->Wait(FTimespan::FromMilliseconds(250));
+        Drain();
+    }
+
+    Drain();
+    CloseFile();
+    return 0;
+}
+
+void FMasterHttpDebugLog::Stop()
+{
+    bStopping = true;
+    if (WakeEvent)
+    {
+        WakeEvent->Trigger();
+    }
+}
+
+void FMasterHttpDebugLog::EnsureThread()
+{
+    if (bThreadStarted)
+        return;
+
+    FScopeLock ScopeLock(&ThreadLock);
+    if (!bThreadStarted && !bStopping)
+    {
+        WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+        Thread = FRunnableThread::Create(this, TEXT("MasterHttpDebugLog"), 0, TPri_BelowNormal);
+        bThreadStarted = true;
+    }
+}
+
+void FMasterHttpDebugLog::Drain()
+{
+    TUniquePtr<FMasterHttpDebugRecord> Record;
+    bool bWrote = false;
+    while (Queue.Dequeue(Record))
+    {
+        QueuedCount.fetch_sub(1);
+        WriteRecord(*Record);
+        bWrote = true;
+    }
+
+    const int64 Dropped = DroppedCount.exchange(0);
+    if (Dropped > 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("⚠️ HTTP debug log fell behind, dropped %lld reports"), Dropped);
+    }
+
+    // One flush per batch instead of one file per request
+    if (bWrote && File)
+    {
+        File->Flush();
+    }
+}
+
+void FMasterHttpDebugLog::WriteRecord(const FMasterHttpDebugRecord& Record)
+{
+    TStringBuilder<4096> Text;
+    FormatText(Record, Text);
+    UE_LOG(LogTemp, Log, TEXT("%s"), Text.ToString());
+
+    RotateIfNeeded();
+    if (!File)
+        return;
+
+    FString Json;
+    if (OpenFormat == EHttpDebugLogFormat::Ndjson)
+    {
+        FormatJson(Record, Json);
+        Json.AppendChar(TEXT('\n'));
+    }
+
+    FTCHARToUTF8 Utf8(OpenFormat == EHttpDebugLogFormat::Ndjson ? *Json : Text.ToString());
+    File->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+}
+
+void FMasterHttpDebugLog::RotateIfNeeded()
+{
+    EHttpDebugLogFormat WantedFormat;
+    int64 WantedMaxBytes;
+    int32 WantedMaxFiles;
+    {
+        FScopeLock ScopeLock(&SettingsLock);
+        WantedFormat = Format;
+        WantedMaxBytes = MaxFileBytes;
+        WantedMaxFiles = MaxFiles;
+    }
+
+    if (File && (OpenFormat != WantedFormat || File->Tell() >= WantedMaxBytes))
+    {
+        const bool bRotate = OpenFormat == WantedFormat;
+        CloseFile();
+
+        if (bRotate)
+        {
+            // MasterHttp.log -> MasterHttp.1.log -> ... ; the oldest file falls off the end
+            IFileManager& FileManager = IFileManager::Get();
+            FileManager.Delete(*MasterHttp::GetDebugLogPath(WantedFormat, WantedMaxFiles - 1), false, true, true);
+            for (int32 Index = WantedMaxFiles - 2; Index >= 0; --Index)
+            {
+                const FString From = MasterHttp::GetDebugLogPath(WantedFormat, Index);
+                if (FileManager.FileExists(*From))
+                {
+                    FileManager.Move(*MasterHttp::GetDebugLogPath(WantedFormat, Index + 1), *From, true, true);
+                }
+            }
+        }
+    }
+
+    if (!File)
+    {
+        const FString Path = MasterHttp::GetDebugLogPath(WantedFormat, 0);
+        File.Reset(IFileManager::Get().CreateFileWriter(*Path, FILEWRITE_Append | FILEWRITE_AllowRead));
+        OpenFormat = WantedFormat;
+        if (File)
+        {
+            UE_LOG(LogTemp, Log, TEXT("💾 HTTP debug log: %s"), *Path);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Error, TEXT("❌ HTTP debug log could not open %s"), *Path);
+        }
+    }
+}
+
+void FMasterHttpDebugLog::CloseFile()
+{
+    if (File)
+    {
+        File->Close();
+        File.Reset();
+    }
+}
+
+void FMasterHttpDebugLog::FormatText(const FMasterHttpDebugRecord& Record, FStringBuilderBase& Out)
+{
+    Out << TEXT("===============================================\n");
+    Out << TEXT("🌐 HTTP REQUEST DEBUG REPORT\n");
+    Out << TEXT("===============================================\n");
+    Out << TEXT("⏰ Timestamp: ") << Record.Timestamp.ToString(TEXT("%Y-%m-%d %H:%M:%S.%s")) << TEXT("\n");
+    Out << TEXT("🎯 URL: ") << Record.URL << TEXT("\n");
+    Out << TEXT("📋 Method: ") << Record.Method << TEXT("\n");
+    Out.Appendf(TEXT("⏱️ Duration: %.2f seconds\n\n"), Record.DurationSeconds);
+
+    MasterHttp::AppendPairs(Out, TEXT("🔍 QUERY PARAMETERS:"), Record.QueryParams, TEXT(" = "));
+    MasterHttp::AppendPairs(Out, TEXT("📝 REQUEST HEADERS:"), Record.RequestHeaders, TEXT(": "));
+    MasterHttp::AppendPairs(Out, TEXT("📦 REQUEST BODY:"), Record.Body, TEXT(": "));
+
+    Out << TEXT("📡 RESPONSE:\n");
+    Out.Appendf(TEXT("   Status: %d %s\n"), Record.StatusCode, *Record.StatusText);
+    Out << TEXT("   Success: ") << (Record.bSuccess ? TEXT("✅ Yes") : TEXT("❌ No")) << TEXT("\n");
+    Out.Appendf(TEXT("   Content Length: %d bytes\n"), Record.ContentLength);
+    Out << TEXT("   Content Type: ") << Record.ContentType << TEXT("\n");
+    if (!Record.ErrorMessage.IsEmpty())
+    {
+        Out << TEXT("   Error: ") << Record.ErrorMessage << TEXT("\n");
+    }
+
+    if (Record.ResponseHeaders.Num() > 0)
+    {
+        Out << TEXT("\n");
+        MasterHttp::AppendPairs(Out, TEXT("📝 RESPONSE HEADERS:"), Record.ResponseHeaders, TEXT(": "));
+    }
+
+    if (!Record.DataPreview.IsEmpty())
+    {
+        Out << TEXT("\n📄 RESPONSE DATA:\n") << Record.DataPreview << TEXT("\n");
+    }
+    else if (Record.RawBytes > 0)
+    {
+        Out.Appendf(TEXT("\n📄 RESPONSE DATA: %lld raw bytes\n"), Record.RawBytes);
+    }
+
+    Out << TEXT("===============================================\n");
+}
+
+void FMasterHttpDebugLog::FormatJson(const FMasterHttpDebugRecord& Record, FString& Out)
+{
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Out);
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("timestamp"), Record.Timestamp.ToIso8601());
+    Writer->WriteValue(TEXT("method"), Record.Method);
+    Writer->WriteValue(TEXT("url"), Record.URL);
+    Writer->WriteValue(TEXT("status"), Record.StatusCode);
+    Writer->WriteValue(TEXT("success"), Record.bSuccess);
+    Writer->WriteValue(TEXT("durationSeconds"), Record.DurationSeconds);
+    Writer->WriteValue(TEXT("contentLength"), Record.ContentLength);
+    Writer->WriteValue(TEXT("contentType"), Record.ContentType);
+    if (!Record.ErrorMessage.IsEmpty())
+    {
+        Writer->WriteValue(TEXT("error"), Record.ErrorMessage);
+    }
+    MasterHttp::WriteJsonPairs(*Writer, TEXT("query"), Record.QueryParams);
+    MasterHttp::WriteJsonPairs(*Writer, TEXT("requestHeaders"), Record.RequestHeaders);
+    MasterHttp::WriteJsonPairs(*Writer, TEXT("body"), Record.Body);
+    MasterHttp::WriteJsonPairs(*Writer, TEXT("responseHeaders"), Record.ResponseHeaders);
+    if (!Record.DataPreview.IsEmpty())
+    {
+        Writer->WriteValue(TEXT("data"), Record.DataPreview);
+    }
+    else if (Record.RawBytes > 0)
+    {
+        Writer->WriteValue(TEXT("rawBytes"), Record.RawBytes);
+    }
+    Writer->WriteObjectEnd();
+    Writer->Close();
+}
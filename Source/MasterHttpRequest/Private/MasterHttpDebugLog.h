@@ -0,0 +1,94 @@
+/*
+==========================================================================================
+File: MasterHttpDebugLog.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "HAL/Runnable.h"
+#include "MasterHttpRequestBPLibrary.h"
+
+class FRunnableThread;
+
+/** Everything a Detailed / Verbose debug report needs, captured on the completing thread and formatted by the writer. */
+struct FMasterHttpDebugRecord
+{
+    FDateTime Timestamp;
+    FString URL;
+    FString Method;
+    TArray<FHttpKeyValue> QueryParams;
+    TArray<FHttpKeyValue> RequestHeaders;
+    TArray<FHttpKeyValue> Body;
+    TArray<FHttpKeyValue> ResponseHeaders;  // Verbose only
+    FString DataPreview;                    // Verbose only, truncated
+    int64 RawBytes = 0;                     // Verbose only, for raw responses
+    int32 StatusCode = 0;
+    FString StatusText;
+    FString ErrorMessage;
+    FString ContentType;
+    int32 ContentLength = 0;
+    float DurationSeconds = 0.0f;
+    bool bSuccess = false;
+};
+
+/**
+ * Background sink for debug reports. Producers push records into a lock-free MPSC queue; a writer thread formats them,
+ * echoes them to the log and appends them to one file under Saved/MasterHttpDebug, rotating it by size.
+ * The thread starts with the first record. Owned by FMasterHttpRequestModule, which flushes it on shutdown.
+ */
+class FMasterHttpDebugLog : public FRunnable
+{
+public:
+    virtual ~FMasterHttpDebugLog() override;
+
+    /** Queue a record for writing. Never blocks; records are dropped if the writer falls too far behind. */
+    void Enqueue(TUniquePtr<FMasterHttpDebugRecord> Record);
+
+    /** Change the file format and rotation. Takes effect from the next record. */
+    void SetSettings(EHttpDebugLogFormat InFormat, int64 InMaxFileBytes, int32 InMaxFiles);
+
+    /** Current log file path. */
+    FString GetLogFilePath() const;
+
+    /** Write everything still queued and stop the writer thread. */
+    void Shutdown();
+
+    //~ FRunnable
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+private:
+    void EnsureThread();
+    void Drain();
+    void WriteRecord(const FMasterHttpDebugRecord& Record);
+    void RotateIfNeeded();
+    void CloseFile();
+
+    static void FormatText(const FMasterHttpDebugRecord& Record, FStringBuilderBase& Out);
+    static void FormatJson(const FMasterHttpDebugRecord& Record, FString& Out);
+
+    TQueue<TUniquePtr<FMasterHttpDebugRecord>, EQueueMode::Mpsc> Queue;
+    std::atomic<int32> QueuedCount{0};
+    std::atomic<int64> DroppedCount{0};
+    std::atomic<bool> bStopping{false};
+    std::atomic<bool> bThreadStarted{false};
+
+    FCriticalSection ThreadLock;
+    FRunnableThread* Thread = nullptr;
+    FEvent* WakeEvent = nullptr;
+
+    // Settings, read by the writer thread
+    mutable FCriticalSection SettingsLock;
+    EHttpDebugLogFormat Format = EHttpDebugLogFormat::Text;
+    int64 MaxFileBytes = 10 * 1024 * 1024;
+    int32 MaxFiles = 5;
+
+    // Writer thread only
+    TUniquePtr<FArchive> File;
+    EHttpDebugLogFormat OpenFormat = EHttpDebugLogFormat::Text;
+};
@@ -0,0 +1,657 @@
+/*
+==========================================================================================
+File: MasterHttpEventStream.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterHttpEventStream.h"
+#include "MasterHttpClient.h"
+#include "MasterHttpRequest.h"
+#include "MasterHttpRequestInternal.h"
+#include "MasterHttpRequestRegistry.h"
+#include "MasterHttpRetry.h"
+#include "MasterHttpTrace.h"
+#include "Containers/Ticker.h"
+#include "Async/Async.h"
+#include <atomic>
+
+namespace MasterHttp
+{
+    bool FServerEventParser::Feed(const uint8* Data, int64 Length, TFunctionRef<void(FHttpServerEvent&&)> OnEvent)
+    {
+        int64 Index = 0;
+        while (Index < Length)
+        {
+            // The LF of a CRLF pair may arrive in the next chunk
+            if (bLastWasCR)
+            {
+                bLastWasCR = false;
+                if (Data[Index] == '\n')
+                {
+                    ++Index;
+                    continue;
+                }
+            }
+
+            int64 End = Index;
+            while (End < Length && Data[End] != '\r' && Data[End] != '\n')
+            {
+                ++End;
+            }
+
+            if (Line.Num() + (End - Index) > MaxLineBytes)
+                return false;
+            Line.Append(Data + Index, static_cast<int32>(End - Index));
+
+            if (End == Length)
+                break;
+
+            bLastWasCR = Data[End] == '\r';
+            ProcessLine(OnEvent);
+            Line.Reset();
+            Index = End + 1;
+        }
+        return true;
+    }
+
+    void FServerEventParser::Reset()
+    {
+        Line.Reset();
+        EventType.Reset();
+        EventData.Reset();
+        PendingEventId.Reset();
+        bPendingEventId = false;
+        bLastWasCR = false;
+        bStartOfStream = true;
+    }
+
+    void FServerEventParser::ProcessLine(TFunctionRef<void(FHttpServerEvent&&)> OnEvent)
+    {
+        int32 Start = 0;
+        if (bStartOfStream)
+        {
+            bStartOfStream = false;
+            if (Line.Num() >= 3 && Line[0] == 0xEF && Line[1] == 0xBB && Line[2] == 0xBF)
+            {
+                Start = 3;
+            }
+        }
+
+        // A blank line dispatches the event collected so far; one without data is dropped, but its id still counts
+        if (Line.Num() == Start)
+        {
+            if (bPendingEventId)
+            {
+                LastEventId = MoveTemp(PendingEventId);
+                PendingEventId.Reset();
+                bPendingEventId = false;
+            }
+            if (!EventData.IsEmpty())
+            {
+                FHttpServerEvent Event;
+                Event.Event = EventType.IsEmpty() ? TEXT("message") : EventType;
+                Event.Data = EventData.LeftChop(1);
+                Event.Id = LastEventId;
+                OnEvent(MoveTemp(Event));
+            }
+            EventType.Reset();
+            EventData.Reset();
+            return;
+        }
+
+        // Lines starting with a colon are comments, typically keep-alive heartbeats
+        if (Line[Start] == ':')
+            return;
+
+        const int32 Colon = Line.Find(':');
+        const int32 FieldEnd = Colon == INDEX_NONE ? Line.Num() : Colon;
+        int32 ValueStart = Colon == INDEX_NONE ? Line.Num() : Colon + 1;
+        if (ValueStart < Line.Num() && Line[ValueStart] == ' ')
+        {
+            ++ValueStart;
+        }
+
+        // Field names are case-sensitive ASCII
+        auto IsField = [this, Start, FieldEnd](const ANSICHAR* Name) {
+            const int32 NameLength = FCStringAnsi::Strlen(Name);
+            return FieldEnd - Start == NameLength && FMemory::Memcmp(Line.GetData() + Start, Name, NameLength) == 0;
+        };
+        const FUTF8ToTCHAR Value(reinterpret_cast<const ANSICHAR*>(Line.GetData() + ValueStart), Line.Num() - ValueStart);
+
+        if (IsField("data"))
+        {
+            EventData.AppendChars(Value.Get(), Value.Length());
+            EventData.AppendChar(TEXT('\n'));
+        }
+        else if (IsField("event"))
+        {
+            EventType = FString::ConstructFromPtrSize(Value.Get(), Value.Length());
+        }
+        else if (IsField("id"))
+        {
+            if (!Line.Contains(0))
+            {
+                PendingEventId = FString::ConstructFromPtrSize(Value.Get(), Value.Length());
+                bPendingEventId = true;
+            }
+        }
+        else if (IsField("retry"))
+        {
+            // ASCII digits only: IsNumeric would also let through "+5"
+            bool bDigitsOnly = Value.Length() > 0;
+            for (int32 i = 0; i < Value.Length() && bDigitsOnly; ++i)
+            {
+                bDigitsOnly = Value.Get()[i] >= TEXT('0') && Value.Get()[i] <= TEXT('9');
+            }
+            if (bDigitsOnly)
+            {
+                const FString Retry = FString::ConstructFromPtrSize(Value.Get(), Value.Length());
+                RetryMilliseconds = static_cast<int32>(FMath::Min<int64>(FCString::Atoi64(*Retry), MAX_int32));
+            }
+        }
+    }
+
+    /** Response built by the plugin itself, for a stream that ends without a connection of its own. */
+    static FHttpResponseSimple MakeLocalResponse(const FString& URL, EHttpErrorKind ErrorKind, const FString& ErrorMessage)
+    {
+        FMasterHttpResult Result;
+        Result.FinalURL = URL;
+        Result.StartTime = FPlatformTime::Seconds();
+        Result.LocalError = ErrorKind;
+        Result.LocalErrorMessage = ErrorMessage;
+        return MakeResponse(Result, EResponseBody::None);
+    }
+
+    /**
+    * One event stream across all of its connections. Kept alive by the connection in flight or the reconnect ticker.
+    * Connect, Drain, OnConnectionComplete, Close and Finish run on the game thread; ReceiveChunk on the HTTP thread.
+    */
+    struct FEventStream : public TSharedFromThis<FEventStream, ESPMode::ThreadSafe>
+    {
+        explicit FEventStream(const FHttpStreamOptions& InStreamOptions)
+            : StreamOptions(InStreamOptions)
+            , Parser(FMath::Max(InStreamOptions.MaxBufferedBytes, 1024))
+        {
+            Parser.LastEventId = InStreamOptions.LastEventId;
+        }
+
+        TWeakObjectPtr<UMasterHttpClient> Client;
+        FHttpRequestDescriptor Request;
+        const FHttpStreamOptions StreamOptions;
+        TFunction<void(const FHttpServerEvent&)> OnEvent;
+        TFunction<void(const FHttpResponseSimple&)> OnClosed;
+        TSharedPtr<FMasterHttpRequestRegistry, ESPMode::ThreadSafe> Registry;
+        TSharedPtr<FMasterHttpRequestState, ESPMode::ThreadSafe> State;     // The stream, as seen by its handle
+
+        // Game thread
+        FHttpRequestHandle Connection;
+        FTSTicker::FDelegateHandle ReconnectTicker;
+        int32 ConsecutiveFailures = 0;
+        bool bFinished = false;
+        bool bConnectionOpen = false;
+        std::atomic<bool> bClosed{false};
+
+        // HTTP thread, reset for every connection
+        TWeakPtr<IHttpRequest, ESPMode::ThreadSafe> HttpRequest;
+        bool bOpened = false;
+        bool bAccepted = false;
+        std::atomic<bool> bOverflow{false};
+
+        // Shared; the parser is only fed while holding the lock so reconnects can read its last event id
+        FCriticalSection Lock;
+        FServerEventParser Parser;
+        TArray<FHttpServerEvent> Pending;
+        int64 PendingBytes = 0;
+        bool bDrainScheduled = false;
+
+        void Connect()
+        {
+            if (bClosed)
+                return;
+
+            UMasterHttpClient* SendClient = Client.Get();
+            if (!SendClient)
+            {
+                Finish(MakeLocalResponse(Request.URL, EHttpErrorKind::ConnectionFailed, TEXT("HTTP client was destroyed")));
+                return;
+            }
+
+            FHttpRequestDescriptor Attempt = Request;
+            {
+                FScopeLock ScopeLock(&Lock);
+                Parser.Reset();
+                if (!Parser.LastEventId.IsEmpty())
+                {
+                    Attempt.CustomHeaders.Add(UMasterHttpRequestBPLibrary::MakeKeyValue(TEXT("Last-Event-ID"), Parser.LastEventId));
+                }
+            }
+            bOpened = false;
+            bAccepted = false;
+            bOverflow = false;
+
+            TSharedRef<FEventStream, ESPMode::ThreadSafe> Self = AsShared();
+            FMasterHttpConfigureRequest Configure = [Self](const FHttpRequestRef& InHttpRequest) {
+                Self->HttpRequest = InHttpRequest;
+
+                // The connection is meant to stay open; only silence counts as a failure
+                InHttpRequest->ClearTimeout();
+                if (Self->StreamOptions.IdleTimeoutSeconds > 0.0f)
+                {
+                    InHttpRequest->SetActivityTimeout(Self->StreamOptions.IdleTimeoutSeconds);
+                }
+
+                InHttpRequest->SetResponseBodyReceiveStreamDelegateV2(FHttpRequestStreamDelegateV2::CreateLambda([Self](void* Ptr, int64& Length) {
+                    Self->ReceiveChunk(static_cast<const uint8*>(Ptr), Length);
+                }));
+            };
+
+            FMasterHttpNativeComplete Complete = [Self](const FMasterHttpResult& Result) {
+                Self->OnConnectionComplete(Result);
+            };
+
+            // A request that fails before reaching the network may complete before ProcessRequest returns
+            bConnectionOpen = true;
+            FHttpRequestHandle NewConnection = SendClient->ProcessRequest(MoveTemp(Attempt), false, MoveTemp(Complete), MoveTemp(Configure));
+            if (bConnectionOpen)
+            {
+                Connection = NewConnection;
+                State->State = EHttpRequestState::InFlight;
+            }
+        }
+
+        /** Parse one chunk. Setting Length to 0 tells the engine to abort the connection. */
+        void ReceiveChunk(const uint8* Ptr, int64& Length)
+        {
+            if (bClosed)
+            {
+                Length = 0;
+                return;
+            }
+
+            if (!bOpened)
+            {
+                bOpened = true;
+                FHttpRequestPtr Pinned = HttpRequest.Pin();
+                FHttpResponsePtr Response = Pinned.IsValid() ? Pinned->GetResponse() : nullptr;
+                bAccepted = Response.IsValid() && Response->GetResponseCode() == EHttpResponseCodes::Ok
+                    && Response->GetContentType().StartsWith(TEXT("text/event-stream"), ESearchCase::IgnoreCase);
+            }
+
+            // Error pages and other content types are not parsed; completion decides what happens next
+            if (!bAccepted)
+                return;
+
+            State->BytesReceived += Length;
+
+            bool bScheduleDrain = false;
+            {
+                FScopeLock ScopeLock(&Lock);
+                const bool bParsed = Parser.Feed(Ptr, Length, [this](FHttpServerEvent&& Event) {
+                    PendingBytes += Event.Event.Len() + Event.Data.Len() + Event.Id.Len();
+                    Pending.Add(MoveTemp(Event));
+                });
+
+                // A game thread that stops draining (hitch, breakpoint) or a line that never ends must not grow memory without bound.
+                // Events already parsed are still delivered; the reconnect resumes from the last id.
+                if (!bParsed || PendingBytes > StreamOptions.MaxBufferedBytes)
+                {
+                    bOverflow = true;
+                }
+
+                if (Pending.Num() > 0 && !bDrainScheduled)
+                {
+                    bDrainScheduled = true;
+                    bScheduleDrain = true;
+                }
+            }
+
+            if (bOverflow)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("⚠️ Event stream %s exceeded %d buffered bytes, dropping the connection"), *Request.URL, StreamOptions.MaxBufferedBytes);
+                Length = 0;
+            }
+
+            if (bScheduleDrain)
+            {
+                AsyncTask(ENamedThreads::GameThread, [Self = AsShared()]() {
+                    Self->Drain();
+                });
+            }
+        }
+
+        void Drain()
+        {
+            TArray<FHttpServerEvent> Events;
+            {
+                FScopeLock ScopeLock(&Lock);
+                Events = MoveTemp(Pending);
+                Pending.Reset();
+                PendingBytes = 0;
+                bDrainScheduled = false;
+            }
+
+            for (const FHttpServerEvent& Event : Events)
+            {
+                // OnEvent may close the stream
+                if (bClosed)
+                    break;
+                ConsecutiveFailures = 0;
+                OnEvent(Event);
+            }
+        }
+
+        void OnConnectionComplete(const FMasterHttpResult& Result)
+        {
+            bConnectionOpen = false;
+            Connection = FHttpRequestHandle();
+            Drain();
+
+            FHttpResponseSimple RespData = MakeResponse(Result, EResponseBody::None);
+            if (Request.Options.DebugLevel != EDebugLevel::None)
+            {
+                UMasterHttpRequestBPLibrary::LogDebugInfo(Result.FinalURL, Request.Method, Request.QueryParams, Request.CustomHeaders, Request.Body, RespData, Request.Options);
+            }
+
+            if (bClosed || RespData.ErrorKind == EHttpErrorKind::Cancelled)
+            {
+                Finish(MoveTemp(RespData));
+                return;
+            }
+
+            // Reconnect after anything a server restart or a network change produces; stop on what a retry cannot fix
+            bool bReconnect = false;
+            if (bOverflow)
+            {
+                RespData.bSuccess = false;
+                RespData.ErrorKind = EHttpErrorKind::ConnectionFailed;
+                RespData.ErrorMessage = FString::Printf(TEXT("Event stream exceeded MaxBufferedBytes (%d)"), StreamOptions.MaxBufferedBytes);
+                bReconnect = true;
+            }
+            else if (RespData.StatusCode == EHttpResponseCodes::Ok)
+            {
+                const bool bEventStream = RespData.ContentType.StartsWith(TEXT("text/event-stream"), ESearchCase::IgnoreCase);
+                if (!bEventStream)
+                {
+                    RespData.bSuccess = false;
+                    RespData.ErrorKind = EHttpErrorKind::HttpStatus;
+                    RespData.ErrorMessage = FString::Printf(TEXT("Expected text/event-stream, got '%s'"), *RespData.ContentType);
+                }
+                bReconnect = bEventStream;
+            }
+            else
+            {
+                // 204 No Content is how a server tells the client to stop reconnecting
+                bReconnect = RespData.StatusCode >= 500 || IsRetryableFailure(Result.Response, Result.bWasSuccessful);
+            }
+
+            const bool bAttemptsLeft = StreamOptions.MaxReconnectAttempts <= 0 || ConsecutiveFailures < StreamOptions.MaxReconnectAttempts;
+            if (bReconnect && StreamOptions.bAutoReconnect && bAttemptsLeft)
+            {
+                ScheduleReconnect(Result);
+                return;
+            }
+
+            Finish(MoveTemp(RespData));
+        }
+
+        void ScheduleReconnect(const FMasterHttpResult& Result)
+        {
+            int32 RetryMilliseconds = -1;
+            {
+                FScopeLock ScopeLock(&Lock);
+                RetryMilliseconds = Parser.RetryMilliseconds;
+            }
+
+            // The server's "retry:" replaces the configured delay; either one doubles while reconnects keep failing
+            const double BaseDelay = RetryMilliseconds >= 0 ? RetryMilliseconds / 1000.0 : StreamOptions.ReconnectDelaySeconds;
+            double Delay = FMath::Min<double>(BaseDelay * FMath::Pow(2.0, static_cast<double>(FMath::Min(ConsecutiveFailures, 16))), FMath::Max<double>(StreamOptions.MaxReconnectDelaySeconds, BaseDelay));
+
+            double RetryAfter = 0.0;
+            if (Result.Response.IsValid() && ParseRetryAfter(Result.Response->GetHeader(TEXT("Retry-After")), RetryAfter))
+            {
+                Delay = FMath::Max(Delay, RetryAfter);
+            }
+
+            ++ConsecutiveFailures;
+            State->State = EHttpRequestState::Queued;
+            UE_LOG(LogTemp, Log, TEXT("🔌 Event stream %s disconnected, reconnecting in %.1fs"), *Request.URL, Delay);
+
+            ReconnectTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Self = AsShared()](float DeltaTime) {
+                Self->ReconnectTicker.Reset();
+                Self->Connect();
+                return false;
+            }), static_cast<float>(Delay));
+        }
+
+        void Close()
+        {
+            if (bClosed.exchange(true))
+                return;
+
+            if (ReconnectTicker.IsValid())
+            {
+                FTSTicker::GetCoreTicker().RemoveTicker(ReconnectTicker);
+                ReconnectTicker.Reset();
+            }
+
+            // The cancelled connection completes and finishes the stream; between connections there is nothing to wait for
+            if (Connection.IsValid())
+            {
+                UMasterHttpRequestBPLibrary::CancelHttpRequest(Connection);
+                return;
+            }
+            Finish(MakeLocalResponse(Request.URL, EHttpErrorKind::Cancelled, TEXT("Request cancelled")));
+        }
+
+        void Finish(FHttpResponseSimple&& RespData)
+        {
+            if (bFinished)
+                return;
+            bFinished = true;
+            bClosed = true;
+
+            if (ReconnectTicker.IsValid())
+            {
+                FTSTicker::GetCoreTicker().RemoveTicker(ReconnectTicker);
+                ReconnectTicker.Reset();
+            }
+
+            if (State->Finish(RespData.bSuccess) && RespData.ErrorKind != EHttpErrorKind::Cancelled)
+            {
+                RespData.bSuccess = false;
+                RespData.ErrorKind = EHttpErrorKind::Cancelled;
+                RespData.ErrorMessage = TEXT("Request cancelled");
+            }
+            Registry->Unregister(State->RequestId);
+            OnClosed(RespData);
+        }
+    };
+
+    /** Receives the body in pieces and hands it to the game thread as text. */
+    struct FChunkStream : public TSharedFromThis<FChunkStream, ESPMode::ThreadSafe>
+    {
+        int32 MaxBufferedBytes = 0;
+        TFunction<void(const FString&)> OnChunk;
+
+        // HTTP thread
+        TWeakPtr<IHttpRequest, ESPMode::ThreadSafe> HttpRequest;
+        bool bOpened = false;
+        bool bDiscardBody = false;
+        std::atomic<bool> bOverflow{false};
+
+        // Shared
+        FCriticalSection Lock;
+        TArray<uint8> Pending;
+        bool bDrainScheduled = false;
+
+        // Game thread: the start of a UTF-8 character whose remaining bytes have not arrived yet
+        TArray<uint8> Carry;
+
+        void ReceiveChunk(const uint8* Ptr, int64& Length)
+        {
+            if (!bOpened)
+            {
+                bOpened = true;
+                FHttpRequestPtr Pinned = HttpRequest.Pin();
+                FHttpResponsePtr Response = Pinned.IsValid() ? Pinned->GetResponse() : nullptr;
+                bDiscardBody = !Response.IsValid() || !EHttpResponseCodes::IsOk(Response->GetResponseCode());
+            }
+
+            if (bDiscardBody)
+                return;
+
+            bool bScheduleDrain = false;
+            {
+                FScopeLock ScopeLock(&Lock);
+                if (Pending.Num() + Length > MaxBufferedBytes)
+                {
+                    bOverflow = true;
+                    Length = 0;
+                    return;
+                }
+
+                Pending.Append(Ptr, static_cast<int32>(Length));
+                bScheduleDrain = !bDrainScheduled;
+                bDrainScheduled = true;
+            }
+
+            if (bScheduleDrain)
+            {
+                AsyncTask(ENamedThreads::GameThread, [Self = AsShared()]() {
+                    Self->Drain(false);
+                });
+            }
+        }
+
+        /** Deliver what arrived, holding back an incomplete trailing character unless this is the end of the body. */
+        void Drain(bool bFinal)
+        {
+            {
+                FScopeLock ScopeLock(&Lock);
+                Carry.Append(Pending);
+                Pending.Reset();
+                bDrainScheduled = false;
+            }
+
+            int32 Complete = Carry.Num();
+            if (!bFinal)
+            {
+                for (int32 Index = Carry.Num() - 1; Index >= FMath::Max(0, Carry.Num() - 4); --Index)
+                {
+                    const uint8 Byte = Carry[Index];
+                    if ((Byte & 0xC0) == 0x80)
+                        continue;
+
+                    const int32 CharBytes = Byte < 0x80 ? 1 : (Byte >= 0xF0 ? 4 : (Byte >= 0xE0 ? 3 : 2));
+                    if (Index + CharBytes > Carry.Num())
+                    {
+                        Complete = Index;
+                    }
+                    break;
+                }
+            }
+
+            if (Complete == 0)
+                return;
+
+            const FUTF8ToTCHAR Text(reinterpret_cast<const ANSICHAR*>(Carry.GetData()), Complete);
+            Carry.RemoveAt(0, Complete, EAllowShrinking::No);
+            OnChunk(FString::ConstructFromPtrSize(Text.Get(), Text.Length()));
+        }
+    };
+}
+
+FHttpRequestHandle MasterHttp::OpenEventStream(UMasterHttpClient* Client, FHttpRequestDescriptor Request, const FHttpStreamOptions& StreamOptions, TFunction<void(const FHttpServerEvent&)> OnEvent, TFunction<void(const FHttpResponseSimple&)> OnClosed)
+{
+    check(IsInGameThread());
+
+    TSharedRef<FEventStream, ESPMode::ThreadSafe> Stream = MakeShared<FEventStream, ESPMode::ThreadSafe>(StreamOptions);
+    Stream->Client = Client;
+    Stream->OnEvent = MoveTemp(OnEvent);
+    Stream->OnClosed = MoveTemp(OnClosed);
+
+    // The handle and its tag belong to the stream; each connection is an untagged request of its own
+    Stream->Registry = FMasterHttpRequestModule::Get().GetRequestRegistry();
+    Stream->State = Stream->Registry->Register(AllocateRequestId(), Request.Options.Tag);
+    Request.Options.Tag = NAME_None;
+
+    // Events are consumed as they arrive, so there is nothing to cache, share or decompress as a whole
+    Request.Options.CachePolicy = EHttpCachePolicy::None;
+    Request.Options.bCoalesceInFlight = false;
+    Request.Options.bDecompressResponses = false;
+    Request.CustomHeaders.Insert(UMasterHttpRequestBPLibrary::MakeKeyValue(TEXT("Accept"), TEXT("text/event-stream")), 0);
+    Request.CustomHeaders.Insert(UMasterHttpRequestBPLibrary::MakeKeyValue(TEXT("Cache-Control"), TEXT("no-cache")), 1);
+    Stream->Request = MoveTemp(Request);
+
+    // Cancelling the handle (directly, by tag or all) may come from any thread; the stream closes on the game thread
+    Stream->State->SetOnCancel([WeakStream = TWeakPtr<FEventStream, ESPMode::ThreadSafe>(Stream)]() {
+        AsyncTask(ENamedThreads::GameThread, [WeakStream]() {
+            if (TSharedPtr<FEventStream, ESPMode::ThreadSafe> Pinned = WeakStream.Pin())
+            {
+                Pinned->Close();
+            }
+        });
+    });
+
+    FHttpRequestHandle Handle;
+    Handle.RequestId = Stream->State->RequestId;
+    Handle.State = Stream->State;
+
+    Stream->Connect();
+    return Handle;
+}
+
+FHttpRequestHandle MasterHttp::StreamResponse(UMasterHttpClient* Client, FHttpRequestDescriptor Request, const FHttpStreamOptions& StreamOptions, TFunction<void(const FString&)> OnChunk, TFunction<void(const FHttpResponseSimple&)> OnComplete)
+{
+    TSharedRef<FChunkStream, ESPMode::ThreadSafe> Stream = MakeShared<FChunkStream, ESPMode::ThreadSafe>();
+    Stream->MaxBufferedBytes = FMath::Max(StreamOptions.MaxBufferedBytes, 1024);
+    Stream->OnChunk = MoveTemp(OnChunk);
+
+    // Chunks must be the bytes the server sent, and they never end up in a complete body worth caching
+    Request.Options.CachePolicy = EHttpCachePolicy::None;
+    Request.Options.bDecompressResponses = false;
+
+    TSharedPtr<const FHttpRequestDescriptor, ESPMode::ThreadSafe> DebugRequest;
+    if (Request.Options.DebugLevel != EDebugLevel::None)
+    {
+        DebugRequest = MakeShared<const FHttpRequestDescriptor, ESPMode::ThreadSafe>(Request);
+    }
+
+    const float IdleTimeoutSeconds = StreamOptions.IdleTimeoutSeconds;
+    FMasterHttpConfigureRequest Configure = [Stream, IdleTimeoutSeconds](const FHttpRequestRef& HttpRequest) {
+        Stream->HttpRequest = HttpRequest;
+
+        // A stream may legitimately run for longer than any overall timeout; only silence counts as a failure
+        HttpRequest->ClearTimeout();
+        if (IdleTimeoutSeconds > 0.0f)
+        {
+            HttpRequest->SetActivityTimeout(IdleTimeoutSeconds);
+        }
+
+        HttpRequest->SetResponseBodyReceiveStreamDelegateV2(FHttpRequestStreamDelegateV2::CreateLambda([Stream](void* Ptr, int64& Length) {
+            Stream->ReceiveChunk(static_cast<const uint8*>(Ptr), Length);
+        }));
+    };
+
+    FMasterHttpNativeComplete Complete = [Stream, DebugRequest, OnComplete = MoveTemp(OnComplete)](const FMasterHttpResult& Result) {
+        Stream->Drain(true);
+
+        FHttpResponseSimple RespData = MakeResponse(Result, EResponseBody::None);
+        if (Stream->bOverflow && RespData.ErrorKind != EHttpErrorKind::Cancelled)
+        {
+            RespData.bSuccess = false;
+            RespData.ErrorKind = EHttpErrorKind::ConnectionFailed;
+            RespData.ErrorMessage = FString::Printf(TEXT("Response stream exceeded MaxBufferedBytes (%d)"), Stream->MaxBufferedBytes);
+        }
+
+        if (DebugRequest.IsValid())
+        {
+            UMasterHttpRequestBPLibrary::LogDebugInfo(Result.FinalURL, DebugRequest->Method, DebugRequest->QueryParams, DebugRequest->CustomHeaders, DebugRequest->Body, RespData, DebugRequest->Options);
+        }
+        OnComplete(RespData);
+    };
+
+    return Client->ProcessRequest(MoveTemp(Request), false, MoveTemp(Complete), MoveTemp(Configure));
+}
@@ -0,0 +1,68 @@
+/*
+==========================================================================================
+File: MasterHttpEventStream.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MasterHttpRequestBPLibrary.h"
+
+class UMasterHttpClient;
+
+/** Responses consumed while they download: server-sent events and raw text chunks (internal use). */
+namespace MasterHttp
+{
+    /**
+    * Incremental text/event-stream parser. Bytes may be split anywhere, including inside a line or a UTF-8 character.
+    * Not thread-safe; one per stream, fed from the HTTP thread.
+    */
+    class FServerEventParser
+    {
+    public:
+        explicit FServerEventParser(int32 InMaxLineBytes)
+            : MaxLineBytes(InMaxLineBytes)
+        {
+        }
+
+        /**
+        * Parse the next piece of the body, calling OnEvent for every completed event.
+        * @return False if a line grew past the maximum size; the rest of the connection should be dropped.
+        */
+        bool Feed(const uint8* Data, int64 Length, TFunctionRef<void(FHttpServerEvent&&)> OnEvent);
+
+        /** Forget a partial line or event, including its id, before a new connection. The last event id and retry delay are kept. */
+        void Reset();
+
+        FString LastEventId;            // Id of the last dispatched event; sent back as Last-Event-ID on reconnect
+        int32 RetryMilliseconds = -1;   // From the server's "retry:" field; -1 until sent
+
+    private:
+        void ProcessLine(TFunctionRef<void(FHttpServerEvent&&)> OnEvent);
+
+        const int32 MaxLineBytes;
+        TArray<uint8> Line;
+        FString EventType;
+        FString EventData;
+        FString PendingEventId;         // From an "id:" line; becomes LastEventId only when its event is dispatched
+        bool bPendingEventId = false;
+        bool bLastWasCR = false;
+        bool bStartOfStream = true;
+    };
+
+    /**
+    * Keep a text/event-stream connection open and call OnEvent (game thread) for every event. Dropped connections
+    * are reopened after a backoff with Last-Event-ID. OnClosed runs once on the game thread when the stream ends
+    * for good. The returned handle covers the whole stream; cancelling it closes the stream.
+    */
+    FHttpRequestHandle OpenEventStream(UMasterHttpClient* Client, FHttpRequestDescriptor Request, const FHttpStreamOptions& StreamOptions, TFunction<void(const FHttpServerEvent&)> OnEvent, TFunction<void(const FHttpResponseSimple&)> OnClosed);
+
+    /**
+    * Send a request and call OnChunk (game thread) with the response body as text while it downloads, split on
+    * whole UTF-8 characters. The body is not kept in the response passed to OnComplete.
+    */
+    FHttpRequestHandle StreamResponse(UMasterHttpClient* Client, FHttpRequestDescriptor Request, const FHttpStreamOptions& StreamOptions, TFunction<void(const FString&)> OnChunk, TFunction<void(const FHttpResponseSimple&)> OnComplete);
+}
@@ -0,0 +1,151 @@
+/*
+==========================================================================================
+File: MasterHttpHostGuard.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterHttpHostGuard.h"
+
+bool FMasterHttpHostGuard::AllowRequest(const FString& Host, bool& bOutProbe)
+{
+    FScopeLock ScopeLock(&Lock);
+    bOutProbe = false;
+    if (FailureThreshold <= 0)
+        return true;
+
+    FHostState* State = Hosts.Find(Host);
+    if (!State || State->Circuit == EHttpCircuitState::Closed)
+        return true;
+
+    if (State->Circuit == EHttpCircuitState::Open)
+    {
+        if (FPlatformTime::Seconds() - State->OpenedAt < OpenSeconds)
+            return false;
+
+        State->Circuit = EHttpCircuitState::HalfOpen;
+        State->bProbeInFlight = false;
+    }
+
+    // Half-open: exactly one probe goes through, everything else keeps failing fast until it reports back
+    if (State->bProbeInFlight)
+        return false;
+
+    State->bProbeInFlight = true;
+    bOutProbe = true;
+    return true;
+}
+
+void FMasterHttpHostGuard::ReleaseProbe(const FString& Host)
+{
+    FScopeLock ScopeLock(&Lock);
+    if (FHostState* State = Hosts.Find(Host))
+    {
+        if (State->Circuit == EHttpCircuitState::HalfOpen)
+        {
+            State->bProbeInFlight = false;
+        }
+    }
+}
+
+double FMasterHttpHostGuard::TryAcquireToken(const FString& Host)
+{
+    FScopeLock ScopeLock(&Lock);
+    const FRateLimit& Limit = GetRateLimit(Host);
+    if (Limit.RequestsPerSecond <= 0.0f)
+        return 0.0;
+
+    FHostState& State = Hosts.FindOrAdd(Host);
+    const double Now = FPlatformTime::Seconds();
+    if (State.Tokens < 0.0)
+    {
+        State.Tokens = Limit.Burst;
+    }
+    else
+    {
+        State.Tokens = FMath::Min<double>(Limit.Burst, State.Tokens + (Now - State.LastRefillTime) * Limit.RequestsPerSecond);
+    }
+    State.LastRefillTime = Now;
+
+    if (State.Tokens >= 1.0)
+    {
+        State.Tokens -= 1.0;
+        return 0.0;
+    }
+    return (1.0 - State.Tokens) / Limit.RequestsPerSecond;
+}
+
+void FMasterHttpHostGuard::RecordResult(const FString& Host, bool bHealthy)
+{
+    FScopeLock ScopeLock(&Lock);
+    if (FailureThreshold <= 0)
+        return;
+
+    FHostState& State = Hosts.FindOrAdd(Host);
+    if (bHealthy)
+    {
+        State.ConsecutiveFailures = 0;
+        State.Circuit = EHttpCircuitState::Closed;
+        State.bProbeInFlight = false;
+        return;
+    }
+
+    ++State.ConsecutiveFailures;
+    if (State.Circuit == EHttpCircuitState::HalfOpen || State.ConsecutiveFailures >= FailureThreshold)
+    {
+        if (State.Circuit != EHttpCircuitState::Open)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("⚡ HTTP circuit opened for %s after %d failures, failing fast for %.0fs"), *Host, State.ConsecutiveFailures, OpenSeconds);
+        }
+        State.Circuit = EHttpCircuitState::Open;
+        State.OpenedAt = FPlatformTime::Seconds();
+        State.bProbeInFlight = false;
+    }
+}
+
+void FMasterHttpHostGuard::SetRateLimit(const FString& Host, float RequestsPerSecond, int32 Burst)
+{
+    FScopeLock ScopeLock(&Lock);
+    FRateLimit Limit;
+    Limit.RequestsPerSecond = FMath::Max(0.0f, RequestsPerSecond);
+    Limit.Burst = FMath::Max(1, Burst);
+
+    if (Host.IsEmpty())
+    {
+        DefaultRateLimit = Limit;
+    }
+    else
+    {
+        HostRateLimits.Add(Host, Limit);
+    }
+
+    // Buckets start full again under the new limit
+    for (TPair<FString, FHostState>& Pair : Hosts)
+    {
+        if (Host.IsEmpty() || Pair.Key == Host)
+        {
+            Pair.Value.Tokens = -1.0;
+        }
+    }
+}
+
+void FMasterHttpHostGuard::SetCircuitBreaker(int32 InFailureThreshold, float InOpenSeconds)
+{
+    FScopeLock ScopeLock(&Lock);
+    FailureThreshold = InFailureThreshold;
+    OpenSeconds = FMath::Max(0.0f, InOpenSeconds);
+}
+
+EHttpCircuitState FMasterHttpHostGuard::GetCircuitState(const FString& Host) const
+{
+    FScopeLock ScopeLock(&Lock);
+    const FHostState* State = Hosts.Find(Host);
+    return State ? State->Circuit : EHttpCircuitState::Closed;
+}
+
+const FMasterHttpHostGuard::FRateLimit& FMasterHttpHostGuard::GetRateLimit(const FString& Host) const
+{
+    const FRateLimit* Limit = HostRateLimits.Find(Host);
+    return Limit ? *Limit : DefaultRateLimit;
+}
@@ -0,0 +1,77 @@
+/*
+==========================================================================================
+File: MasterHttpHostGuard.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MasterHttpRequestBPLibrary.h"
+
+/**
+ * Per-host protection in front of the scheduler.
+ * - Token bucket rate limiter: RequestsPerSecond tokens refill a bucket of Burst tokens; a request without a token waits.
+ * - Circuit breaker (off by default): FailureThreshold consecutive failures (no response or 5xx) open the circuit, and requests fail fast
+ *   for OpenSeconds. After that a single probe is let through (half-open); its result closes or re-opens the circuit.
+ * Owned by FMasterHttpRequestModule; safe to use from any thread.
+ */
+class FMasterHttpHostGuard
+{
+public:
+    /**
+    * Whether a request to Host may proceed. False while the circuit is open (or half-open with a probe in flight).
+    * @param bOutProbe - True if the request was let through as the half-open probe; it must then report back with
+    *                    RecordResult, or with ReleaseProbe if it ends without a result.
+    */
+    bool AllowRequest(const FString& Host, bool& bOutProbe);
+
+    /** Let another request probe Host after the probe was cancelled. The circuit stays half-open. */
+    void ReleaseProbe(const FString& Host);
+
+    /**
+    * Take a rate limiter token for Host.
+    * @return 0 if a token was taken, otherwise the seconds to wait before trying again.
+    */
+    double TryAcquireToken(const FString& Host);
+
+    /** Report the outcome of an attempt to update the circuit. */
+    void RecordResult(const FString& Host, bool bHealthy);
+
+    /** Set the rate limit for one host, or the default for every host when Host is empty. RequestsPerSecond <= 0 disables it. */
+    void SetRateLimit(const FString& Host, float RequestsPerSecond, int32 Burst);
+
+    /** Configure the circuit breaker for every host. FailureThreshold <= 0 disables it. */
+    void SetCircuitBreaker(int32 InFailureThreshold, float InOpenSeconds);
+
+    EHttpCircuitState GetCircuitState(const FString& Host) const;
+
+private:
+    struct FHostState
+    {
+        double Tokens = -1.0;           // < 0 until the bucket is first used, then starts full
+        double LastRefillTime = 0.0;
+        EHttpCircuitState Circuit = EHttpCircuitState::Closed;
+        int32 ConsecutiveFailures = 0;
+        double OpenedAt = 0.0;
+        bool bProbeInFlight = false;
+    };
+
+    struct FRateLimit
+    {
+        float RequestsPerSecond = 0.0f;
+        int32 Burst = 1;
+    };
+
+    const FRateLimit& GetRateLimit(const FString& Host) const;
+
+    mutable FCriticalSection Lock;
+    TMap<FString, FHostState> Hosts;
+    TMap<FString, FRateLimit> HostRateLimits;
+    FRateLimit DefaultRateLimit;
+
+    int32 FailureThreshold = 0;     // Off until SetCircuitBreaker is called
+    float OpenSeconds = 30.0f;
+};
@@ -0,0 +1,422 @@
+/*
+==========================================================================================
+File: MasterHttpLoadTest.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterHttpLoadTest.h"
+#include "MasterHttpRequestBPLibrary.h"
+#include "MasterHttpRequest.h"
+#include "MasterHttpScheduler.h"
+#include "MasterHttpBenchmarks.h"
+#include "HAL/IConsoleManager.h"
+#include "Containers/Ticker.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/Parse.h"
+#include "Misc/DateTime.h"
+#include "Math/RandomStream.h"
+
+#if MASTERHTTP_WITH_LOADTEST
+#include "HttpServerModule.h"
+#include "IHttpRouter.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "HttpPath.h"
+#include "HttpRouteHandle.h"
+#endif
+
+FMasterHttpLoadTestSettings FMasterHttpLoadTestSettings::FromString(const TCHAR* Params)
+{
+    FMasterHttpLoadTestSettings Settings;
+    FParse::Value(Params, TEXT("Port="), Settings.Port);
+    FParse::Value(Params, TEXT("Requests="), Settings.Requests);
+    FParse::Value(Params, TEXT("Concurrency="), Settings.Concurrency);
+    FParse::Value(Params, TEXT("LatencyMs="), Settings.LatencyMs);
+    FParse::Value(Params, TEXT("PayloadBytes="), Settings.PayloadBytes);
+    FParse::Value(Params, TEXT("ErrorRate="), Settings.ErrorRate);
+    FParse::Value(Params, TEXT("ErrorStatus="), Settings.ErrorStatus);
+    FParse::Value(Params, TEXT("ResponseStatus="), Settings.ResponseStatus);
+    FParse::Value(Params, TEXT("Seed="), Settings.Seed);
+
+    Settings.Requests = FMath::Max(1, Settings.Requests);
+    Settings.Concurrency = FMath::Max(1, Settings.Concurrency);
+    Settings.LatencyMs = FMath::Max(0, Settings.LatencyMs);
+    Settings.PayloadBytes = FMath::Max(64, Settings.PayloadBytes);
+    Settings.ErrorRate = FMath::Clamp(Settings.ErrorRate, 0.0f, 1.0f);
+    return Settings;
+}
+
+FString FMasterHttpLoadTestSettings::ToString() const
+{
+    return FString::Printf(TEXT("%d requests, concurrency %d, latency %d ms, payload %d bytes, error rate %.3f (%d), status %d, seed %d"),
+        Requests, Concurrency, LatencyMs, PayloadBytes, ErrorRate, ErrorStatus, ResponseStatus, Seed);
+}
+
+#if MASTERHTTP_WITH_LOADTEST
+
+namespace MasterHttpBenchmarks
+{
+    /**
+     * Stand-in HTTP server on 127.0.0.1, answering /masterhttp/load with a JSON body of the configured size.
+     * Runs on the game thread like every HTTPServer listener. Delayed responses only hold the payload, not the server.
+     */
+    class FMockServer
+    {
+    public:
+        ~FMockServer() { Stop(); }
+
+        bool Start(const FMasterHttpLoadTestSettings& InSettings)
+        {
+            Settings = InSettings;
+            Random.Initialize(Settings.Seed);
+
+            // {"items":[{"id":0,"name":"item_0","price":0.99},...]} padded to PayloadBytes
+            FString Json = TEXT("{\"items\":[");
+            for (int32 i = 0; Json.Len() < Settings.PayloadBytes - 64; ++i)
+            {
+                Json += FString::Printf(TEXT("%s{\"id\":%d,\"name\":\"item_%d\",\"price\":%d.99}"), i > 0 ? TEXT(",") : TEXT(""), i, i, i % 100);
+            }
+            Json += TEXT("]}");
+            FTCHARToUTF8 Utf8(*Json);
+            Payload = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+
+            Router = FHttpServerModule::Get().GetHttpRouter(Settings.Port, /*bFailOnBindFailure*/ true);
+            if (!Router.IsValid())
+                return false;
+
+            RouteHandle = Router->BindRoute(FHttpPath(TEXT("/masterhttp/load")), EHttpServerRequestVerbs::VERB_GET | EHttpServerRequestVerbs::VERB_POST,
+                FHttpRequestHandler::CreateRaw(this, &FMockServer::HandleRequest));
+            if (!RouteHandle.IsValid())
+                return false;
+
+            FHttpServerModule::Get().StartAllListeners();
+            return true;
+        }
+
+        void Stop()
+        {
+            // The listener stays up for anything else bound to the port; only our route goes away
+            if (Router.IsValid() && RouteHandle.IsValid())
+                Router->UnbindRoute(RouteHandle);
+            RouteHandle.Reset();
+            Router.Reset();
+        }
+
+    private:
+        bool HandleRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+        {
+            const int32 Status = Random.FRand() < Settings.ErrorRate ? Settings.ErrorStatus : Settings.ResponseStatus;
+            auto Respond = [Payload = Payload, Status, OnComplete]()
+            {
+                TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(TArray<uint8>(*Payload), TEXT("application/json"));
+                Response->Code = static_cast<EHttpServerResponseCodes>(Status);
+                OnComplete(MoveTemp(Response));
+            };
+
+            if (Settings.LatencyMs <= 0)
+            {
+                Respond();
+                return true;
+            }
+
+            FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Respond](float)
+            {
+                Respond();
+                return false;
+            }), Settings.LatencyMs / 1000.0f);
+            return true;
+        }
+
+        FMasterHttpLoadTestSettings Settings;
+        FRandomStream Random;
+        TSharedPtr<TArray<uint8>, ESPMode::ThreadSafe> Payload;
+        TSharedPtr<IHttpRouter> Router;
+        FHttpRouteHandle RouteHandle;
+    };
+
+    static double Percentile(const TArray<double>& Sorted, double Fraction)
+    {
+        if (Sorted.Num() == 0)
+            return 0.0;
+        const int32 Index = FMath::Clamp(FMath::CeilToInt(Fraction * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+        return Sorted[Index];
+    }
+
+    static TWeakObjectPtr<UMasterHttpLoadRunner> GConsoleRunner;
+
+    static FAutoConsoleCommand GMasterHttpLoadTestCommand(
+        TEXT("MasterHttp.LoadTest"),
+        TEXT("Drive SendHttpRequest, QuickGet, QuickPost and DecodeJson against a local mock server. Usage: MasterHttp.LoadTest [Requests=1000] [Concurrency=32] [LatencyMs=0] [PayloadBytes=4096] [ErrorRate=0] [ErrorStatus=500] [ResponseStatus=200] [Port=8089] [Seed=1337]"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            if (GConsoleRunner.IsValid() && GConsoleRunner->IsRunning())
+            {
+                UE_LOG(LogTemp, Warning, TEXT("⚠️ A load test is already running"));
+                return;
+            }
+
+            UMasterHttpLoadRunner* Runner = NewObject<UMasterHttpLoadRunner>();
+            Runner->AddToRoot();
+            GConsoleRunner = Runner;
+            if (!Runner->Start(FMasterHttpLoadTestSettings::FromString(*FString::Join(Args, TEXT(" "))), [Runner]() { Runner->RemoveFromRoot(); }))
+            {
+                Runner->RemoveFromRoot();
+            }
+        }));
+}
+
+#endif // MASTERHTTP_WITH_LOADTEST
+
+bool UMasterHttpLoadRunner::Start(const FMasterHttpLoadTestSettings& InSettings, TFunction<void()> InOnFinished)
+{
+#if MASTERHTTP_WITH_LOADTEST
+    if (bRunning)
+        return false;
+
+    Settings = InSettings;
+    OnFinished = MoveTemp(InOnFinished);
+
+    Server = MakeShared<MasterHttpBenchmarks::FMockServer>();
+    if (!Server->Start(Settings))
+    {
+        UE_LOG(LogTemp, Error, TEXT("❌ Load test: could not listen on port %d"), Settings.Port);
+        Server.Reset();
+        return false;
+    }
+
+    BaseURL = FString::Printf(TEXT("http://127.0.0.1:%d/masterhttp/load"), Settings.Port);
+    PostBody = TEXT("{\"player\":\"load\",\"score\":1200,\"tags\":[\"pvp\",\"ranked\"]}");
+
+    // Let the harness, not the default per-host cap, decide how many requests are in flight; restored by Finish
+    TSharedRef<FMasterHttpScheduler, ESPMode::ThreadSafe> Scheduler = FMasterHttpRequestModule::Get().GetScheduler();
+    PreviousHostLimit = Scheduler->GetHostLimitOverride(TEXT("127.0.0.1"));
+    Scheduler->SetHostLimit(TEXT("127.0.0.1"), Settings.Concurrency);
+
+    SubmitTimes.Init(0.0, Settings.Requests);
+    Latencies.Reset(Settings.Requests);
+    StatusCounts.Reset();
+    ErrorCounts.Reset();
+    Issued = 0;
+    Completed = 0;
+    Decoded = 0;
+    Failed = 0;
+    GameThreadSeconds = 0.0;
+    GameThreadAllocations = 0;
+    bRunning = true;
+
+    UE_LOG(LogTemp, Display, TEXT("🚀 HTTP load test: %s"), *Settings.ToString());
+
+#if UE_STATS
+    AllocationsAtStart = MasterHttpBenchmarks::GetAllocationCallCount();
+#endif
+    StartTime = FPlatformTime::Seconds();
+    IssueRequests();
+    return true;
+#else
+    UE_LOG(LogTemp, Warning, TEXT("⚠️ The HTTP load test is not available in shipping builds"));
+    return false;
+#endif
+}
+
+void UMasterHttpLoadRunner::IssueRequests()
+{
+#if MASTERHTTP_WITH_LOADTEST
+    FHttpResponseDelegate Callback;
+    Callback.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UMasterHttpLoadRunner, HandleResponse));
+
+    while (Issued < Settings.Requests && Issued - Completed < Settings.Concurrency)
+    {
+        const int32 Seq = Issued++;
+        const FString SeqString = FString::FromInt(Seq);
+
+        const double SubmitStart = FPlatformTime::Seconds();
+        SubmitTimes[Seq] = SubmitStart;
+#if UE_STATS
+        const uint64 AllocationsBefore = MasterHttpBenchmarks::GetAllocationCallCount();
+#endif
+        switch (Seq % 3)
+        {
+            case 0:
+                UMasterHttpRequestBPLibrary::SendHttpRequest(BaseURL, EHttpMethod::GET, {}, {}, { UMasterHttpRequestBPLibrary::MakeKeyValue(TEXT("seq"), SeqString) }, {}, Callback, FHttpOptions());
+                break;
+            case 1:
+                UMasterHttpRequestBPLibrary::QuickGet(BaseURL + TEXT("?seq=") + SeqString, Callback, FHttpOptions());
+                break;
+            default:
+                UMasterHttpRequestBPLibrary::QuickPost(BaseURL + TEXT("?seq=") + SeqString, PostBody, Callback, FHttpOptions());
+                break;
+        }
+#if UE_STATS
+        GameThreadAllocations += MasterHttpBenchmarks::GetAllocationCallCount() - AllocationsBefore;
+#endif
+        GameThreadSeconds += FPlatformTime::Seconds() - SubmitStart;
+    }
+#endif
+}
+
+void UMasterHttpLoadRunner::HandleResponse(FHttpResponseSimple Response)
+{
+#if MASTERHTTP_WITH_LOADTEST
+    if (!bRunning)
+        return;
+
+    const double CallbackStart = FPlatformTime::Seconds();
+#if UE_STATS
+    const uint64 AllocationsBefore = MasterHttpBenchmarks::GetAllocationCallCount();
+#endif
+
+    // Every request carries its sequence number in the query string
+    int32 SeqIndex = INDEX_NONE;
+    if (Response.URL.FindLastChar(TEXT('='), SeqIndex))
+    {
+        const int32 Seq = FCString::Atoi(*Response.URL + SeqIndex + 1);
+        if (SubmitTimes.IsValidIndex(Seq))
+            Latencies.Add((CallbackStart - SubmitTimes[Seq]) * 1000.0);
+    }
+
+    StatusCounts.FindOrAdd(Response.StatusCode)++;
+    if (Response.ErrorKind != EHttpErrorKind::None)
+        ErrorCounts.FindOrAdd(Response.ErrorKind)++;
+
+    if (!Response.bSuccess)
+    {
+        ++Failed;
+    }
+    else
+    {
+        EJsonDecodeResult Result;
+        FString Value;
+        TArray<FHttpKeyValue> ObjectFields;
+        TArray<FString> ArrayValues;
+        UMasterHttpRequestBPLibrary::DecodeJson(Response.Data, TEXT("items[0].price"), Result, Value, ObjectFields, ArrayValues);
+        Decoded += Result == EJsonDecodeResult::Value ? 1 : 0;
+    }
+
+#if UE_STATS
+    GameThreadAllocations += MasterHttpBenchmarks::GetAllocationCallCount() - AllocationsBefore;
+#endif
+    GameThreadSeconds += FPlatformTime::Seconds() - CallbackStart;
+
+    if (++Completed >= Settings.Requests)
+    {
+        Finish();
+        return;
+    }
+    IssueRequests();
+#endif
+}
+
+void UMasterHttpLoadRunner::Finish()
+{
+#if MASTERHTTP_WITH_LOADTEST
+    const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+#if UE_STATS
+    const uint64 TotalAllocations = MasterHttpBenchmarks::GetAllocationCallCount() - AllocationsAtStart;
+#else
+    const uint64 TotalAllocations = 0;
+#endif
+
+    FMasterHttpRequestModule::Get().GetScheduler()->SetHostLimit(TEXT("127.0.0.1"), PreviousHostLimit);
+    Server.Reset();
+    bRunning = false;
+
+    TArray<double> Sorted = Latencies;
+    Sorted.Sort();
+    double MeanMs = 0.0;
+    for (double Ms : Sorted)
+    {
+        MeanMs += Ms;
+    }
+    MeanMs = Sorted.Num() > 0 ? MeanMs / Sorted.Num() : 0.0;
+
+    const double Throughput = ElapsedSeconds > 0.0 ? Completed / ElapsedSeconds : 0.0;
+    const double GameThreadUs = GameThreadSeconds * 1e6 / Completed;
+    // Written as "n/a" when the engine does not count allocation calls (builds without stats)
+    const FString GameThreadAllocs = MasterHttpBenchmarks::FormatAllocationCount(static_cast<double>(GameThreadAllocations) / Completed);
+    const FString TotalAllocs = MasterHttpBenchmarks::FormatAllocationCount(static_cast<double>(TotalAllocations) / Completed);
+    const double P50 = MasterHttpBenchmarks::Percentile(Sorted, 0.50);
+    const double P90 = MasterHttpBenchmarks::Percentile(Sorted, 0.90);
+    const double P99 = MasterHttpBenchmarks::Percentile(Sorted, 0.99);
+    const double MaxMs = Sorted.Num() > 0 ? Sorted.Last() : 0.0;
+
+    FString Statuses;
+    for (const TPair<int32, int32>& Pair : StatusCounts)
+    {
+        Statuses += FString::Printf(TEXT("%s%d x %d"), Statuses.IsEmpty() ? TEXT("") : TEXT(", "), Pair.Key, Pair.Value);
+    }
+    FString Errors;
+    for (const TPair<EHttpErrorKind, int32>& Pair : ErrorCounts)
+    {
+        Errors += FString::Printf(TEXT("%s%s x %d"), Errors.IsEmpty() ? TEXT("") : TEXT(", "),
+            *StaticEnum<EHttpErrorKind>()->GetNameStringByValue(static_cast<int64>(Pair.Key)), Pair.Value);
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("📊 HTTP load test: %d requests in %.2f s"), Completed, ElapsedSeconds);
+    UE_LOG(LogTemp, Display, TEXT("   Throughput: %.1f requests/s"), Throughput);
+    UE_LOG(LogTemp, Display, TEXT("   Latency ms: mean %.2f, p50 %.2f, p90 %.2f, p99 %.2f, max %.2f"), MeanMs, P50, P90, P99, MaxMs);
+    UE_LOG(LogTemp, Display, TEXT("   Game thread per request: %.1f us (submit + callback, including DecodeJson)"), GameThreadUs);
+    UE_LOG(LogTemp, Display, TEXT("   Allocations per request: %s during game thread work (other threads included), %s process-wide"), *GameThreadAllocs, *TotalAllocs);
+    UE_LOG(LogTemp, Display, TEXT("   Failed: %d, status codes: %s"), Failed, *Statuses);
+    UE_LOG(LogTemp, Display, TEXT("   Errors: %s"), Errors.IsEmpty() ? TEXT("none") : *Errors);
+    UE_LOG(LogTemp, Display, TEXT("   DecodeJson values: %d"), Decoded);
+
+    // One row per run, so results from different plugin versions can be compared side by side
+    const FString Path = FPaths::ProjectSavedDir() / TEXT("MasterHttpLoadTest") / TEXT("results.csv");
+    FString Row;
+    if (!FPaths::FileExists(Path))
+        Row += TEXT("Timestamp,Requests,Concurrency,LatencyMs,PayloadBytes,ErrorRate,Seconds,RequestsPerSecond,MeanMs,P50Ms,P90Ms,P99Ms,MaxMs,GameThreadUs,GameThreadAllocs,TotalAllocs,Failed\n");
+    Row += FString::Printf(TEXT("%s,%d,%d,%d,%d,%.3f,%.3f,%.1f,%.3f,%.3f,%.3f,%.3f,%.3f,%.1f,%s,%s,%d\n"),
+        *FDateTime::UtcNow().ToIso8601(), Completed, Settings.Concurrency, Settings.LatencyMs, Settings.PayloadBytes, Settings.ErrorRate,
+        ElapsedSeconds, Throughput, MeanMs, P50, P90, P99, MaxMs, GameThreadUs, *GameThreadAllocs, *TotalAllocs, Failed);
+    FFileHelper::SaveStringToFile(Row, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+    UE_LOG(LogTemp, Display, TEXT("   Results appended to %s"), *Path);
+
+    if (OnFinished)
+    {
+        TFunction<void()> Callback = MoveTemp(OnFinished);
+        Callback();
+    }
+#endif
+}
+
+UMasterHttpLoadTestCommandlet::UMasterHttpLoadTestCommandlet()
+{
+    IsClient = false;
+    IsEditor = false;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UMasterHttpLoadTestCommandlet::Main(const FString& Params)
+{
+#if MASTERHTTP_WITH_LOADTEST
+    UMasterHttpLoadRunner* Runner = NewObject<UMasterHttpLoadRunner>();
+    Runner->AddToRoot();
+    if (!Runner->Start(FMasterHttpLoadTestSettings::FromString(*Params), nullptr))
+    {
+        Runner->RemoveFromRoot();
+        return 1;
+    }
+
+    // No engine loop runs during a commandlet: pump the ticker (HTTP manager, HTTP server) and game thread tasks ourselves
+    double LastTime = FPlatformTime::Seconds();
+    while (Runner->IsRunning() && !IsEngineExitRequested())
+    {
+        const double Now = FPlatformTime::Seconds();
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FTSTicker::GetCoreTicker().Tick(static_cast<float>(Now - LastTime));
+        LastTime = Now;
+        FPlatformProcess::Sleep(0.0f);
+    }
+
+    Runner->RemoveFromRoot();
+    return 0;
+#else
+    UE_LOG(LogTemp, Error, TEXT("❌ The HTTP load test is not available in shipping builds"));
+    return 1;
+#endif
+}
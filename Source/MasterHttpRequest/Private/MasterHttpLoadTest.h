@@ -0,0 +1,109 @@
+/*
+==========================================================================================
+File: MasterHttpLoadTest.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Commandlets/Commandlet.h"
+#include "MasterHttpRequestBPLibrary.h"
+#include "MasterHttpLoadTest.generated.h"
+
+namespace MasterHttpBenchmarks
+{
+    class FMockServer;
+}
+
+/**
+ * Settings of a load test run.
+ * Read from "Key=Value" console arguments or "-Key=Value" commandlet switches, e.g. "Requests=5000 Concurrency=64 LatencyMs=20".
+ */
+struct FMasterHttpLoadTestSettings
+{
+    int32 Port = 8089;              // Local port of the mock server
+    int32 Requests = 1000;          // Total requests, split evenly between SendHttpRequest, QuickGet and QuickPost
+    int32 Concurrency = 32;         // Requests kept in flight
+    int32 LatencyMs = 0;            // Delay added by the mock server before each response
+    int32 PayloadBytes = 4096;      // Size of the JSON response body
+    float ErrorRate = 0.0f;         // Fraction of responses answered with ErrorStatus (0-1)
+    int32 ResponseStatus = 200;     // Status of the other responses
+    int32 ErrorStatus = 500;
+    int32 Seed = 1337;              // Seed of the error pattern, so runs are reproducible
+
+    static FMasterHttpLoadTestSettings FromString(const TCHAR* Params);
+    FString ToString() const;
+};
+
+/**
+ * Drives the plugin against an in-process mock server and reports throughput, latency percentiles,
+ * game thread time and allocations per request. Used by the MasterHttp.LoadTest console command and
+ * UMasterHttpLoadTestCommandlet. Only functional in non-shipping builds.
+ */
+UCLASS(Transient)
+class UMasterHttpLoadRunner : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+    * Start the mock server and begin issuing requests.
+    * @param InSettings - What to run.
+    * @param InOnFinished - Called on the game thread once every response is in and the report is written.
+    * @return False if the mock server could not listen on the port, or a run is already in progress.
+    */
+    bool Start(const FMasterHttpLoadTestSettings& InSettings, TFunction<void()> InOnFinished);
+
+    bool IsRunning() const { return bRunning; }
+
+private:
+    UFUNCTION()
+    void HandleResponse(FHttpResponseSimple Response);
+
+    void IssueRequests();
+    void Finish();
+
+    FMasterHttpLoadTestSettings Settings;
+    TFunction<void()> OnFinished;
+    FString BaseURL;
+    FString PostBody;
+
+    TSharedPtr<MasterHttpBenchmarks::FMockServer> Server;
+    int32 PreviousHostLimit = 0;    // Mock server host override to restore when the run ends (0 = none)
+
+    // Process-wide allocation calls, read from the engine allocator's counters in stats builds only (nothing is hooked during the run)
+    uint64 AllocationsAtStart = 0;
+    uint64 GameThreadAllocations = 0;   // Made while the game thread was submitting or handling callbacks
+
+    TArray<double> SubmitTimes;     // Indexed by sequence number
+    TArray<double> Latencies;       // Milliseconds, in completion order
+    TMap<int32, int32> StatusCounts;
+    TMap<EHttpErrorKind, int32> ErrorCounts;
+
+    int32 Issued = 0;
+    int32 Completed = 0;
+    int32 Decoded = 0;
+    int32 Failed = 0;
+    double StartTime = 0.0;
+    double GameThreadSeconds = 0.0;
+    bool bRunning = false;
+};
+
+/**
+ * Runs a load test from the command line and appends the results to Saved/MasterHttpLoadTest/results.csv.
+ * UnrealEditor-Cmd <Project> -run=MasterHttpLoadTest -Requests=5000 -Concurrency=64 -LatencyMs=20 -PayloadBytes=16384 -ErrorRate=0.01
+ */
+UCLASS()
+class UMasterHttpLoadTestCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UMasterHttpLoadTestCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
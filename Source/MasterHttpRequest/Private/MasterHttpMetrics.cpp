@@ -0,0 +1,380 @@
+/*
+==========================================================================================
+File: MasterHttpMetrics.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterHttpMetrics.h"
+#include "MasterHttpRequest.h"
+#include "MasterHttpRequestInternal.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeRWLock.h"
+#include "Async/Async.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+
+// Histogram
+
+void FMasterHttpLatencyHistogram::Record(double Seconds)
+{
+    const uint64 Micros = static_cast<uint64>(FMath::Max(0.0, Seconds) * 1000000.0);
+    Buckets[GetBucketIndex(Micros)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void FMasterHttpLatencyHistogram::Reset()
+{
+    for (std::atomic<int64>& Bucket : Buckets)
+    {
+        Bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void FMasterHttpLatencyHistogram::AccumulateInto(TArray<int64>& Out) const
+{
+    Out.SetNumZeroed(NumBuckets, EAllowShrinking::No);
+    for (int32 Index = 0; Index < NumBuckets; ++Index)
+    {
+        Out[Index] += Buckets[Index].load(std::memory_order_relaxed);
+    }
+}
+
+double FMasterHttpLatencyHistogram::GetPercentile(const TArray<int64>& InBuckets, double Percentile)
+{
+    int64 Total = 0;
+    for (int64 Count : InBuckets)
+    {
+        Total += Count;
+    }
+    if (Total == 0)
+        return 0.0;
+
+    // Rank of the sample at this percentile (nearest-rank method)
+    const int64 Rank = FMath::Max<int64>(1, FMath::CeilToInt64(Percentile / 100.0 * Total));
+    int64 Seen = 0;
+    for (int32 Index = 0; Index < InBuckets.Num(); ++Index)
+    {
+        Seen += InBuckets[Index];
+        if (Seen >= Rank)
+        {
+            return GetBucketMidpoint(Index) / 1000000.0;
+        }
+    }
+    return GetBucketMidpoint(InBuckets.Num() - 1) / 1000000.0;
+}
+
+int32 FMasterHttpLatencyHistogram::GetBucketIndex(uint64 Micros)
+{
+    if (Micros < SubBuckets)
+        return static_cast<int32>(Micros);
+
+    // The top 5 bits of the value pick the bucket: the exponent, then 16 linear steps within that power of two
+    const int32 Exponent = FMath::Min<int32>(FMath::FloorLog2_64(Micros), MaxExponent);
+    const int32 Sub = static_cast<int32>((Micros >> (Exponent - 4)) & (SubBuckets - 1));
+    return SubBuckets + (Exponent - 4) * SubBuckets + Sub;
+}
+
+double FMasterHttpLatencyHistogram::GetBucketMidpoint(int32 Index)
+{
+    if (Index < SubBuckets)
+        return Index;
+
+    const int32 Exponent = (Index - SubBuckets) / SubBuckets + 4;
+    const int32 Sub = (Index - SubBuckets) % SubBuckets;
+    const double Width = static_cast<double>(uint64(1) << (Exponent - 4));
+    return (SubBuckets + Sub) * Width + Width * 0.5;
+}
+
+// Registry
+
+namespace MasterHttp
+{
+    /** Path segments that identify one item rather than a resource type. */
+    static bool IsIdSegment(const FString& Segment)
+    {
+        int32 Digits = 0;
+        int32 HexOrDash = 0;
+        for (TCHAR Char : Segment)
+        {
+            Digits += FChar::IsDigit(Char) ? 1 : 0;
+            HexOrDash += (FChar::IsHexDigit(Char) || Char == TEXT('-')) ? 1 : 0;
+        }
+        return Digits == Segment.Len()                                  // 42
+            || (Segment.Len() >= 16 && HexOrDash == Segment.Len())      // UUIDs, hashes
+            || (Segment.Len() >= 12 && Digits * 2 >= Segment.Len());    // mixed ids like a1b2c3d4e5f6
+    }
+
+    static void DumpMetrics(const TArray<FString>& Args)
+    {
+        const bool bPerRoute = !(Args.Num() > 0 && Args[0].Equals(TEXT("hosts"), ESearchCase::IgnoreCase));
+        const TArray<FHttpMetricsEntry> Entries = FMasterHttpRequestModule::Get().GetMetrics()->GetSnapshot(bPerRoute);
+
+        UE_LOG(LogTemp, Display, TEXT("📈 HTTP metrics (%d %s)"), Entries.Num(), bPerRoute ? TEXT("routes") : TEXT("hosts"));
+        UE_LOG(LogTemp, Display, TEXT("%-28s %-40s %8s %6s %6s %6s %6s %6s %9s %9s %9s %9s %10s %10s"),
+            TEXT("Host"), TEXT("Route"), TEXT("Count"), TEXT("2xx"), TEXT("3xx"), TEXT("4xx"), TEXT("5xx"), TEXT("Err"),
+            TEXT("p50 ms"), TEXT("p95 ms"), TEXT("p99 ms"), TEXT("max ms"), TEXT("KB out"), TEXT("KB in"));
+        for (const FHttpMetricsEntry& Entry : Entries)
+        {
+            UE_LOG(LogTemp, Display, TEXT("%-28s %-40s %8lld %6lld %6lld %6lld %6lld %6lld %9.1f %9.1f %9.1f %9.1f %10.1f %10.1f"),
+                *Entry.Host, *Entry.Route, Entry.Requests, Entry.Status2xx, Entry.Status3xx, Entry.Status4xx, Entry.Status5xx, Entry.Errors,
+                Entry.P50Ms, Entry.P95Ms, Entry.P99Ms, Entry.MaxMs, Entry.BytesSent / 1024.0, Entry.BytesReceived / 1024.0);
+        }
+    }
+
+    static FAutoConsoleCommand DumpMetricsCommand(
+        TEXT("MasterHttp.Metrics"),
+        TEXT("Print HTTP request metrics with latency percentiles. Args: [routes|hosts] (default routes)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&DumpMetrics));
+
+    static FAutoConsoleCommand ResetMetricsCommand(
+        TEXT("MasterHttp.Metrics.Reset"),
+        TEXT("Clear all HTTP request metrics"),
+        FConsoleCommandDelegate::CreateLambda([]() {
+            FMasterHttpRequestModule::Get().GetMetrics()->Reset();
+        }));
+
+    static FAutoConsoleCommand ExportMetricsCommand(
+        TEXT("MasterHttp.Metrics.Export"),
+        TEXT("Write HTTP request metrics to Saved/MasterHttpMetrics. Args: [csv|json] (default csv)"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+            const bool bJson = Args.Num() > 0 && Args[0].Equals(TEXT("json"), ESearchCase::IgnoreCase);
+            const FString Path = FMasterHttpRequestModule::Get().GetMetrics()->Export(bJson ? EHttpMetricsExportFormat::Json : EHttpMetricsExportFormat::Csv);
+            UE_LOG(LogTemp, Display, TEXT("💾 HTTP metrics written to %s"), *Path);
+        }));
+}
+
+FMasterHttpMetrics::FMasterHttpMetrics() = default;
+
+FMasterHttpMetrics::~FMasterHttpMetrics()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(ExportTicker);
+}
+
+FString FMasterHttpMetrics::MakeRoute(EHttpMethod Method, const FString& URL)
+{
+    FString Path = FGenericPlatformHttp::GetUrlPath(URL, false, false);
+    TArray<FString> Segments;
+    Path.ParseIntoArray(Segments, TEXT("/"));
+
+    TStringBuilder<256> Route;
+    Route << MasterHttp::GetVerbString(Method) << TEXT(" ");
+    for (const FString& Segment : Segments)
+    {
+        Route << TEXT("/") << (MasterHttp::IsIdSegment(Segment) ? TEXT("{id}") : *Segment);
+    }
+    if (Segments.Num() == 0)
+    {
+        Route << TEXT("/");
+    }
+    return FString(Route.ToView());
+}
+
+void FMasterHttpMetrics::Record(EHttpMethod Method, const FMasterHttpResult& Result)
+{
+    FRow& Row = FindOrAddRow(FGenericPlatformHttp::GetUrlDomain(Result.FinalURL), MakeRoute(Method, Result.FinalURL));
+    Row.Requests.fetch_add(1, std::memory_order_relaxed);
+
+    const FHttpResponsePtr& Response = Result.Response;
+    if (Result.bWasSuccessful && Response.IsValid() && Result.LocalError == EHttpErrorKind::None)
+    {
+        const int32 Code = Response->GetResponseCode();
+        std::atomic<int64>& Class = Code >= 500 ? Row.Status5xx : Code >= 400 ? Row.Status4xx : Code >= 300 ? Row.Status3xx : Row.Status2xx;
+        Class.fetch_add(1, std::memory_order_relaxed);
+        Row.BytesReceived.fetch_add(Result.BytesReceived >= 0 ? Result.BytesReceived : Response->GetContent().Num(), std::memory_order_relaxed);
+    }
+    else
+    {
+        Row.Errors.fetch_add(1, std::memory_order_relaxed);
+    }
+    Row.BytesSent.fetch_add(Result.BytesSent, std::memory_order_relaxed);
+
+    const double End = Result.CompletedTime > 0.0 ? Result.CompletedTime : FPlatformTime::Seconds();
+    const double Seconds = Result.SubmitTime > 0.0 ? End - Result.SubmitTime : 0.0;
+    const int64 Micros = static_cast<int64>(Seconds * 1000000.0);
+    Row.TotalMicros.fetch_add(Micros, std::memory_order_relaxed);
+    int64 PreviousMax = Row.MaxMicros.load(std::memory_order_relaxed);
+    while (Micros > PreviousMax && !Row.MaxMicros.compare_exchange_weak(PreviousMax, Micros, std::memory_order_relaxed))
+    {
+    }
+    Row.Latency.Record(Seconds);
+}
+
+FMasterHttpMetrics::FRow& FMasterHttpMetrics::FindOrAddRow(const FString& Host, const FString& Route)
+{
+    const FString Key = Host + TEXT(" ") + Route;
+    {
+        FReadScopeLock ReadLock(RowsLock);
+        if (const TUniquePtr<FRow>* Found = Rows.Find(Key))
+        {
+            return **Found;
+        }
+    }
+
+    FWriteScopeLock WriteLock(RowsLock);
+    if (const TUniquePtr<FRow>* Found = Rows.Find(Key))
+    {
+        return **Found;
+    }
+
+    if (Rows.Num() >= MaxRows)
+    {
+        const FString OverflowKey = Host + TEXT(" (other)");
+        if (const TUniquePtr<FRow>* Overflow = Rows.Find(OverflowKey))
+        {
+            return **Overflow;
+        }
+        TUniquePtr<FRow>& Row = Rows.Add(OverflowKey, MakeUnique<FRow>());
+        Row->Host = Host;
+        Row->Route = TEXT("(other)");
+        return *Row;
+    }
+
+    TUniquePtr<FRow>& Row = Rows.Add(Key, MakeUnique<FRow>());
+    Row->Host = Host;
+    Row->Route = Route;
+    return *Row;
+}
+
+TArray<FHttpMetricsEntry> FMasterHttpMetrics::GetSnapshot(bool bPerRoute) const
+{
+    struct FAccumulated
+    {
+        FHttpMetricsEntry Entry;
+        TArray<int64> Buckets;
+        int64 TotalMicros = 0;
+        int64 MaxMicros = 0;
+    };
+    TMap<FString, FAccumulated> Groups;
+
+    {
+        FReadScopeLock ReadLock(RowsLock);
+        for (const TPair<FString, TUniquePtr<FRow>>& Pair : Rows)
+        {
+            const FRow& Row = *Pair.Value;
+            FAccumulated& Group = Groups.FindOrAdd(bPerRoute ? Pair.Key : Row.Host);
+            Group.Entry.Host = Row.Host;
+            Group.Entry.Route = bPerRoute ? Row.Route : FString();
+            Group.Entry.Requests += Row.Requests.load(std::memory_order_relaxed);
+            Group.Entry.Status2xx += Row.Status2xx.load(std::memory_order_relaxed);
+            Group.Entry.Status3xx += Row.Status3xx.load(std::memory_order_relaxed);
+            Group.Entry.Status4xx += Row.Status4xx.load(std::memory_order_relaxed);
+            Group.Entry.Status5xx += Row.Status5xx.load(std::memory_order_relaxed);
+            Group.Entry.Errors += Row.Errors.load(std::memory_order_relaxed);
+            Group.Entry.BytesSent += Row.BytesSent.load(std::memory_order_relaxed);
+            Group.Entry.BytesReceived += Row.BytesReceived.load(std::memory_order_relaxed);
+            Group.TotalMicros += Row.TotalMicros.load(std::memory_order_relaxed);
+            Group.MaxMicros = FMath::Max(Group.MaxMicros, Row.MaxMicros.load(std::memory_order_relaxed));
+            Row.Latency.AccumulateInto(Group.Buckets);
+        }
+    }
+
+    TArray<FHttpMetricsEntry> Entries;
+    Entries.Reserve(Groups.Num());
+    for (TPair<FString, FAccumulated>& Pair : Groups)
+    {
+        FAccumulated& Group = Pair.Value;
+        FHttpMetricsEntry& Entry = Entries.Add_GetRef(MoveTemp(Group.Entry));
+        Entry.P50Ms = static_cast<float>(FMasterHttpLatencyHistogram::GetPercentile(Group.Buckets, 50.0) * 1000.0);
+        Entry.P95Ms = static_cast<float>(FMasterHttpLatencyHistogram::GetPercentile(Group.Buckets, 95.0) * 1000.0);
+        Entry.P99Ms = static_cast<float>(FMasterHttpLatencyHistogram::GetPercentile(Group.Buckets, 99.0) * 1000.0);
+        Entry.MaxMs = Group.MaxMicros / 1000.0f;
+        Entry.MeanMs = Entry.Requests > 0 ? static_cast<float>(Group.TotalMicros / 1000.0 / Entry.Requests) : 0.0f;
+    }
+
+    Entries.Sort([](const FHttpMetricsEntry& A, const FHttpMetricsEntry& B) { return A.Requests > B.Requests; });
+    return Entries;
+}
+
+void FMasterHttpMetrics::Reset()
+{
+    // Rows stay allocated: other threads may be recording into them right now
+    FReadScopeLock ReadLock(RowsLock);
+    for (const TPair<FString, TUniquePtr<FRow>>& Pair : Rows)
+    {
+        FRow& Row = *Pair.Value;
+        for (std::atomic<int64>* Counter : { &Row.Requests, &Row.Status2xx, &Row.Status3xx, &Row.Status4xx, &Row.Status5xx, &Row.Errors, &Row.BytesSent, &Row.BytesReceived, &Row.TotalMicros, &Row.MaxMicros })
+        {
+            Counter->store(0, std::memory_order_relaxed);
+        }
+        Row.Latency.Reset();
+    }
+}
+
+void FMasterHttpMetrics::SetPeriodicExport(float IntervalSeconds, EHttpMetricsExportFormat Format)
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(ExportTicker);
+    ExportTicker.Reset();
+    if (IntervalSeconds <= 0.0f)
+        return;
+
+    ExportTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this, Format](float DeltaTime) {
+        // The snapshot is cheap; formatting and the file write are not, so they run in the background
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Entries = GetSnapshot(true), Format]() {
+            WriteExport(Entries, Format);
+        });
+        return true;
+    }), IntervalSeconds);
+}
+
+FString FMasterHttpMetrics::Export(EHttpMetricsExportFormat Format) const
+{
+    return WriteExport(GetSnapshot(true), Format);
+}
+
+FString FMasterHttpMetrics::WriteExport(const TArray<FHttpMetricsEntry>& Entries, EHttpMetricsExportFormat Format)
+{
+    const bool bJson = Format == EHttpMetricsExportFormat::Json;
+    const FString Path = FPaths::ProjectSavedDir() / TEXT("MasterHttpMetrics") / (bJson ? TEXT("metrics.json") : TEXT("metrics.csv"));
+    FFileHelper::SaveStringToFile(bJson ? FormatJson(Entries) : FormatCsv(Entries), *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+    return Path;
+}
+
+FString FMasterHttpMetrics::FormatCsv(const TArray<FHttpMetricsEntry>& Entries)
+{
+    TStringBuilder<4096> Csv;
+    Csv << TEXT("Host,Route,Requests,Status2xx,Status3xx,Status4xx,Status5xx,Errors,BytesSent,BytesReceived,MeanMs,P50Ms,P95Ms,P99Ms,MaxMs\n");
+    for (const FHttpMetricsEntry& Entry : Entries)
+    {
+        Csv.Appendf(TEXT("%s,\"%s\",%lld,%lld,%lld,%lld,%lld,%lld,%lld,%lld,%.2f,%.2f,%.2f,%.2f,%.2f\n"),
+            *Entry.Host, *Entry.Route.Replace(TEXT("\""), TEXT("\"\"")), Entry.Requests, Entry.Status2xx, Entry.Status3xx, Entry.Status4xx, Entry.Status5xx,
+            Entry.Errors, Entry.BytesSent, Entry.BytesReceived, Entry.MeanMs, Entry.P50Ms, Entry.P95Ms, Entry.P99Ms, Entry.MaxMs);
+    }
+    return FString(Csv.ToView());
+}
+
+FString FMasterHttpMetrics::FormatJson(const TArray<FHttpMetricsEntry>& Entries)
+{
+    FString Json;
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+    Writer->WriteArrayStart(TEXT("routes"));
+    for (const FHttpMetricsEntry& Entry : Entries)
+    {
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("host"), Entry.Host);
+        Writer->WriteValue(TEXT("route"), Entry.Route);
+        Writer->WriteValue(TEXT("requests"), Entry.Requests);
+        Writer->WriteValue(TEXT("status2xx"), Entry.Status2xx);
+        Writer->WriteValue(TEXT("status3xx"), Entry.Status3xx);
+        Writer->WriteValue(TEXT("status4xx"), Entry.Status4xx);
+        Writer->WriteValue(TEXT("status5xx"), Entry.Status5xx);
+        Writer->WriteValue(TEXT("errors"), Entry.Errors);
+        Writer->WriteValue(TEXT("bytesSent"), Entry.BytesSent);
+        Writer->WriteValue(TEXT("bytesReceived"), Entry.BytesReceived);
+        Writer->WriteValue(TEXT("meanMs"), Entry.MeanMs);
+        Writer->WriteValue(TEXT("p50Ms"), Entry.P50Ms);
+        Writer->WriteValue(TEXT("p95Ms"), Entry.P95Ms);
+        Writer->WriteValue(TEXT("p99Ms"), Entry.P99Ms);
+        Writer->WriteValue(TEXT("maxMs"), Entry.MaxMs);
+        Writer->WriteObjectEnd();
+    }
+    Writer->WriteArrayEnd();
+    Writer->WriteObjectEnd();
+    Writer->Close();
+    return Json;
+}
@@ -0,0 +1,102 @@
+/*
+==========================================================================================
+File: MasterHttpMetrics.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "MasterHttpClient.h"
+#include <atomic>
+
+/**
+ * Latency histogram with log-linear buckets (16 per power of two, ~6% resolution) from 1 microsecond to several hours.
+ * Recording is a few relaxed atomic increments, so any thread can record without a lock.
+ */
+class FMasterHttpLatencyHistogram
+{
+public:
+    static constexpr int32 SubBuckets = 16;
+    static constexpr int32 MaxExponent = 36;
+    static constexpr int32 NumBuckets = SubBuckets + (MaxExponent - 3) * SubBuckets;
+
+    void Record(double Seconds);
+    void Reset();
+
+    /** Add this histogram's counts into Out (NumBuckets entries). */
+    void AccumulateInto(TArray<int64>& Out) const;
+
+    /** Latency in seconds at Percentile (0..100) of a bucket array filled by AccumulateInto. */
+    static double GetPercentile(const TArray<int64>& Buckets, double Percentile);
+
+private:
+    static int32 GetBucketIndex(uint64 Micros);
+    static double GetBucketMidpoint(int32 Index);
+
+    std::atomic<int64> Buckets[NumBuckets] = {};
+};
+
+/**
+ * Request statistics per host and route, owned by FMasterHttpRequestModule.
+ * Routes are "METHOD /path" with numeric and id-like path segments collapsed to "{id}", so per-item URLs share a row.
+ * Rows are created under a lock once; after that every counter is a lock-free atomic.
+ */
+class FMasterHttpMetrics
+{
+public:
+    FMasterHttpMetrics();
+    ~FMasterHttpMetrics();
+
+    /** Record a request the pipeline has finished with. */
+    void Record(EHttpMethod Method, const FMasterHttpResult& Result);
+
+    /** Current values, one entry per route, or per host when bPerRoute is false. Sorted by request count. */
+    TArray<FHttpMetricsEntry> GetSnapshot(bool bPerRoute) const;
+
+    void Reset();
+
+    /** Write a snapshot to Saved/MasterHttpMetrics every IntervalSeconds (0 stops exporting). */
+    void SetPeriodicExport(float IntervalSeconds, EHttpMetricsExportFormat Format);
+
+    /** Write a snapshot now. Returns the file written. */
+    FString Export(EHttpMetricsExportFormat Format) const;
+
+    /** Collapse a URL into its metrics route. */
+    static FString MakeRoute(EHttpMethod Method, const FString& URL);
+
+private:
+    struct FRow
+    {
+        FString Host;
+        FString Route;
+        std::atomic<int64> Requests{0};
+        std::atomic<int64> Status2xx{0};
+        std::atomic<int64> Status3xx{0};
+        std::atomic<int64> Status4xx{0};
+        std::atomic<int64> Status5xx{0};
+        std::atomic<int64> Errors{0};
+        std::atomic<int64> BytesSent{0};
+        std::atomic<int64> BytesReceived{0};
+        std::atomic<int64> TotalMicros{0};
+        std::atomic<int64> MaxMicros{0};
+        FMasterHttpLatencyHistogram Latency;
+    };
+
+    FRow& FindOrAddRow(const FString& Host, const FString& Route);
+
+    static FString WriteExport(const TArray<FHttpMetricsEntry>& Entries, EHttpMetricsExportFormat Format);
+    static FString FormatCsv(const TArray<FHttpMetricsEntry>& Entries);
+    static FString FormatJson(const TArray<FHttpMetricsEntry>& Entries);
+
+    /** Rows beyond this share one overflow row per host, so unbounded URL shapes cannot grow memory forever. */
+    static constexpr int32 MaxRows = 256;
+
+    mutable FRWLock RowsLock;
+    TMap<FString, TUniquePtr<FRow>> Rows;
+
+    FTSTicker::FDelegateHandle ExportTicker;
+};
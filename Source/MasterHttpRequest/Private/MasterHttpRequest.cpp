@@ -8,6 +8,14 @@ Publisher: MJGT Studio
 ==========================================================================================
 */
 #include "MasterHttpRequest.h"
+#include "MasterHttpClient.h"
+#include "MasterHttpScheduler.h"
+#include "MasterHttpCache.h"
+#include "MasterHttpCoalescer.h"
+#include "MasterHttpHostGuard.h"
+#include "MasterHttpDebugLog.h"
+#include "MasterHttpMetrics.h"
+#include "MasterHttpRequestRegistry.h"
 
 #define LOCTEXT_NAMESPACE "FMasterHttpRequestModule"
 
@@ -15,6 +23,13 @@ void FMasterHttpRequestModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
 
+	Scheduler = MakeShared<FMasterHttpScheduler, ESPMode::ThreadSafe>();
+	ResponseCache = MakeShared<FMasterHttpResponseCache, ESPMode::ThreadSafe>();
+	Coalescer = MakeShared<FMasterHttpCoalescer, ESPMode::ThreadSafe>();
+	HostGuard = MakeShared<FMasterHttpHostGuard, ESPMode::ThreadSafe>();
+	DebugLog = MakeShared<FMasterHttpDebugLog, ESPMode::ThreadSafe>();
+	Metrics = MakeShared<FMasterHttpMetrics, ESPMode::ThreadSafe>();
+	RequestRegistry = MakeShared<FMasterHttpRequestRegistry, ESPMode::ThreadSafe>();
 }
 
 void FMasterHttpRequestModule::ShutdownModule()
@@ -22,6 +37,28 @@ void FMasterHttpRequestModule::ShutdownModule()
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
 
+	if (DefaultClient && UObjectInitialized())
+	{
+		DefaultClient->RemoveFromRoot();
+	}
+	DefaultClient = nullptr;
+
+	// Write out debug reports still queued so the last requests before exit are not lost
+	if (DebugLog.IsValid())
+	{
+		DebugLog->Shutdown();
+	}
+}
+
+UMasterHttpClient* FMasterHttpRequestModule::GetDefaultClient()
+{
+	if (!DefaultClient)
+	{
+		check(IsInGameThread());
+		DefaultClient = NewObject<UMasterHttpClient>();
+		DefaultClient->AddToRoot();
+	}
+	return DefaultClient;
 }
 
 #undef LOCTEXT_NAMESPACE
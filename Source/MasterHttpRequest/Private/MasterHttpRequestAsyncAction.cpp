@@ -0,0 +1,103 @@
+/*
+==========================================================================================
+File: MasterHttpRequestAsyncAction.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterHttpRequestAsyncAction.h"
+#include "MasterHttpClient.h"
+
+UMasterHttpRequestAsyncAction* UMasterHttpRequestAsyncAction::SendHttpRequestAsync(
+    UObject* WorldContextObject,
+    const FString& URL,
+    EHttpMethod Method,
+    TArray<FHttpHeaderEnumValue> DefaultHeaders,
+    TArray<FHttpKeyValue> CustomHeaders,
+    TArray<FHttpKeyValue> QueryParams,
+    TArray<FHttpKeyValue> Body,
+    FHttpOptions Options)
+{
+    FHttpRequestDescriptor Request = UMasterHttpRequestBPLibrary::MakeRequestDescriptor(URL, Method, MoveTemp(DefaultHeaders), MoveTemp(CustomHeaders), MoveTemp(QueryParams), MoveTemp(Body), MoveTemp(Options));
+    return SendRequestDescriptorAsync(WorldContextObject, Request, nullptr);
+}
+
+UMasterHttpRequestAsyncAction* UMasterHttpRequestAsyncAction::SendRequestDescriptorAsync(UObject* WorldContextObject, const FHttpRequestDescriptor& Request, UMasterHttpClient* Client)
+{
+    UMasterHttpRequestAsyncAction* Action = NewObject<UMasterHttpRequestAsyncAction>();
+    Action->Request = Request;
+    Action->Client = Client;
+    Action->RegisterWithGameInstance(WorldContextObject);
+    return Action;
+}
+
+void UMasterHttpRequestAsyncAction::Activate()
+{
+    UMasterHttpClient* SendClient = Client ? Client.Get() : UMasterHttpClient::GetDefaultHttpClient();
+
+    // Weak: the node may be destroyed with its game instance before the response arrives
+    TWeakObjectPtr<UMasterHttpRequestAsyncAction> WeakThis(this);
+    FMasterHttpNativeComplete OnComplete = UMasterHttpClient::MakeNativeCompletion(Request, [WeakThis](FHttpResponseSimple&& Response) {
+        if (UMasterHttpRequestAsyncAction* Action = WeakThis.Get())
+        {
+            Action->HandleResponse(MoveTemp(Response));
+        }
+    });
+
+    // Progress is polled from the handle once per frame rather than pushed from the HTTP thread
+    if (OnProgress.IsBound())
+    {
+        ProgressTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UMasterHttpRequestAsyncAction::TickProgress));
+    }
+
+    Handle = SendClient->ProcessRequest(Request, false, MoveTemp(OnComplete));
+}
+
+void UMasterHttpRequestAsyncAction::Cancel()
+{
+    UMasterHttpRequestBPLibrary::CancelHttpRequest(Handle);
+}
+
+void UMasterHttpRequestAsyncAction::HandleResponse(FHttpResponseSimple&& Response)
+{
+    int64 BytesSent = 0;
+    int64 BytesReceived = 0;
+    int64 BytesExpected = 0;
+    UMasterHttpRequestBPLibrary::GetHttpRequestProgress(Handle, BytesSent, BytesReceived, BytesExpected);
+
+    if (Response.bSuccess)
+    {
+        OnSuccess.Broadcast(MoveTemp(Response), BytesReceived, BytesExpected);
+    }
+    else
+    {
+        OnFailure.Broadcast(MoveTemp(Response), BytesReceived, BytesExpected);
+    }
+    SetReadyToDestroy();
+}
+
+bool UMasterHttpRequestAsyncAction::TickProgress(float DeltaTime)
+{
+    int64 BytesSent = 0;
+    int64 BytesReceived = 0;
+    int64 BytesExpected = 0;
+    UMasterHttpRequestBPLibrary::GetHttpRequestProgress(Handle, BytesSent, BytesReceived, BytesExpected);
+
+    if (BytesReceived != LastBytesReceived)
+    {
+        LastBytesReceived = BytesReceived;
+        OnProgress.Broadcast(FHttpResponseSimple(), BytesReceived, BytesExpected);
+    }
+    return true;
+}
+
+void UMasterHttpRequestAsyncAction::SetReadyToDestroy()
+{
+    if (ProgressTicker.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(ProgressTicker);
+        ProgressTicker.Reset();
+    }
+    Super::SetReadyToDestroy();
+}
@@ -7,17 +7,31 @@ Publisher: MJGT Studio
 ==========================================================================================
 */
 #include "MasterHttpRequestBPLibrary.h"
+#include "MasterHttpRequestInternal.h"
+#include "MasterHttpClient.h"
+#include "MasterHttpRequest.h"
+#include "MasterHttpScheduler.h"
+#include "MasterHttpTransfer.h"
+#include "MasterHttpEventStream.h"
+#include "MasterHttpBatch.h"
+#include "MasterHttpCache.h"
+#include "MasterHttpCoalescer.h"
+#include "MasterHttpHostGuard.h"
+#include "MasterHttpDebugLog.h"
+#include "MasterHttpMetrics.h"
+#include "MasterHttpRequestRegistry.h"
+#include "MasterHttpTrace.h"
+#include "MasterJsonDocument.h"
+#include "MasterJsonPath.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Json.h"
 #include "JsonUtilities.h"
-#include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "GenericPlatform/GenericPlatformHttp.h"
 #include "Async/Async.h"
 #include "Dom/JsonObject.h"
-#include "HAL/PlatformFilemanager.h"
 
 FHttpKeyValue UMasterHttpRequestBPLibrary::MakeKeyValue(const FString& Key, const FString& Value)
 {
@@ -36,6 +50,56 @@ FHttpHeaderEnumValue UMasterHttpRequestBPLibrary::MakeEnumHeader(EHttpHeaderKey
     return Header;
 }
 
+FString UMasterHttpRequestBPLibrary::GetResponseContentAsString(const FHttpResponseSimple& Response)
+{
+    if (!Response.Data.IsEmpty() || Response.Content.Num() == 0)
+        return Response.Data;
+
+    FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Response.Content.GetData()), Response.Content.Num());
+    return FString::ConstructFromPtrSize(Converted.Get(), Converted.Length());
+}
+
+bool UMasterHttpRequestBPLibrary::GetResponseHeader(const FHttpResponseSimple& Response, const FString& Name, FString& Value)
+{
+    Value.Reset();
+    if (Name.IsEmpty())
+        return false;
+
+    // Unsplit lines: match "Name:" in place, so only the found value is copied
+    if (Response.RawHeaderLines.IsValid())
+    {
+        for (const FString& Line : *Response.RawHeaderLines)
+        {
+            if (Line.Len() > Name.Len() && Line[Name.Len()] == TEXT(':') && FCString::Strnicmp(*Line, *Name, Name.Len()) == 0)
+            {
+                Value = Line.RightChop(Name.Len() + 1).TrimStart();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    for (const FHttpKeyValue& Header : Response.Headers)
+    {
+        if (Header.Key.Equals(Name, ESearchCase::IgnoreCase))
+        {
+            Value = Header.Value;
+            return true;
+        }
+    }
+    return false;
+}
+
+TArray<FHttpKeyValue> UMasterHttpRequestBPLibrary::GetResponseHeaders(const FHttpResponseSimple& Response)
+{
+    if (Response.Headers.Num() > 0 || !Response.RawHeaderLines.IsValid())
+        return Response.Headers;
+
+    TArray<FHttpKeyValue> Headers;
+    MasterHttp::SplitHeaders(*Response.RawHeaderLines, Headers);
+    return Headers;
+}
+
 TArray<FHttpKeyValue> UMasterHttpRequestBPLibrary::GetDefaultJsonHeaders()
 {
     TArray<FHttpKeyValue> Headers;
@@ -44,7 +108,7 @@ TArray<FHttpKeyValue> UMasterHttpRequestBPLibrary::GetDefaultJsonHeaders()
     return Headers;
 }
 
-void UMasterHttpRequestBPLibrary::SendHttpRequest(
+FHttpRequestHandle UMasterHttpRequestBPLibrary::SendHttpRequest(
     const FString& URL,
     EHttpMethod Method,
     TArray<FHttpHeaderEnumValue> DefaultHeaders,
@@ -54,317 +118,436 @@ void UMasterHttpRequestBPLibrary::SendHttpRequest(
     FHttpResponseDelegate Callback,
     FHttpOptions Options)
 {
-    auto RequestLambda = [=]() {
-        double StartTime = FPlatformTime::Seconds();
+    FHttpRequestDescriptor Request = MakeRequestDescriptor(URL, Method, MoveTemp(DefaultHeaders), MoveTemp(CustomHeaders), MoveTemp(QueryParams), MoveTemp(Body), MoveTemp(Options));
+    FMasterHttpNativeComplete OnComplete = UMasterHttpClient::MakeDelegateCompletion(Request, MoveTemp(Callback));
+    return UMasterHttpClient::GetDefaultHttpClient()->ProcessRequest(MoveTemp(Request), false, MoveTemp(OnComplete));
+}
 
-        FString FinalURL = URL;
-        if (QueryParams.Num() > 0)
-        {
-            TArray<FString> QueryArray;
-            for (const auto& Param : QueryParams)
-            {
-                QueryArray.Add(FGenericPlatformHttp::UrlEncode(Param.Key) + TEXT("=") + FGenericPlatformHttp::UrlEncode(Param.Value));
-            }
-            FinalURL += (URL.Contains(TEXT("?")) ? TEXT("&") : TEXT("?")) + FString::Join(QueryArray, TEXT("&"));
-        }
+FHttpRequestHandle UMasterHttpRequestBPLibrary::SendHttpRequestBinary(
+    const FString& URL,
+    EHttpMethod Method,
+    TArray<FHttpHeaderEnumValue> DefaultHeaders,
+    TArray<FHttpKeyValue> CustomHeaders,
+    TArray<FHttpKeyValue> QueryParams,
+    TArray<uint8> Content,
+    FHttpResponseDelegate Callback,
+    FHttpOptions Options)
+{
+    FHttpRequestDescriptor Request = MakeRequestDescriptor(URL, Method, MoveTemp(DefaultHeaders), MoveTemp(CustomHeaders), MoveTemp(QueryParams), {}, MoveTemp(Options));
+    Request.BinaryBody = MoveTemp(Content);
+    FMasterHttpNativeComplete OnComplete = UMasterHttpClient::MakeDelegateCompletion(Request, MoveTemp(Callback));
+    return UMasterHttpClient::GetDefaultHttpClient()->ProcessRequest(MoveTemp(Request), false, MoveTemp(OnComplete));
+}
 
-        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-        HttpRequest->SetURL(FinalURL);
+FHttpRequestHandle UMasterHttpRequestBPLibrary::SendHttpRequestJson(
+    const FString& URL,
+    EHttpMethod Method,
+    TArray<FHttpHeaderEnumValue> DefaultHeaders,
+    TArray<FHttpKeyValue> CustomHeaders,
+    TArray<FHttpKeyValue> QueryParams,
+    const FString& JsonBody,
+    FHttpResponseDelegate Callback,
+    FHttpOptions Options)
+{
+    FHttpRequestDescriptor Request = MakeRequestDescriptor(URL, Method, MoveTemp(DefaultHeaders), MoveTemp(CustomHeaders), MoveTemp(QueryParams), {}, MoveTemp(Options));
+    Request.JsonBody = JsonBody;
+    FMasterHttpNativeComplete OnComplete = UMasterHttpClient::MakeDelegateCompletion(Request, MoveTemp(Callback));
+    return UMasterHttpClient::GetDefaultHttpClient()->ProcessRequest(MoveTemp(Request), false, MoveTemp(OnComplete));
+}
 
-        FString Verb;
-        switch (Method)
-        {
-            case EHttpMethod::GET: Verb = TEXT("GET"); break;
-            case EHttpMethod::POST: Verb = TEXT("POST"); break;
-            case EHttpMethod::PUT: Verb = TEXT("PUT"); break;
-            case EHttpMethod::DELETE: Verb = TEXT("DELETE"); break;
-            case EHttpMethod::PATCH: Verb = TEXT("PATCH"); break;
-            default: Verb = TEXT("GET"); break;
-        }
-        HttpRequest->SetVerb(Verb);
+FHttpRequestHandle UMasterHttpRequestBPLibrary::SendHttpRequestStruct(
+    const FString& URL,
+    EHttpMethod Method,
+    TArray<FHttpHeaderEnumValue> DefaultHeaders,
+    TArray<FHttpKeyValue> CustomHeaders,
+    TArray<FHttpKeyValue> QueryParams,
+    const FInstancedStruct& Body,
+    FHttpResponseDelegate Callback,
+    FHttpOptions Options)
+{
+    FHttpRequestDescriptor Request = MakeRequestDescriptor(URL, Method, MoveTemp(DefaultHeaders), MoveTemp(CustomHeaders), MoveTemp(QueryParams), {}, MoveTemp(Options));
+    const bool bEncoded = Body.IsValid() && SetJsonBodyFromStruct(Request, Body.GetScriptStruct(), Body.GetMemory());
+    FMasterHttpNativeComplete OnComplete = UMasterHttpClient::MakeDelegateCompletion(Request, MoveTemp(Callback));
 
-        // Build headers with improved content type handling
-        TMap<FString, FString> FinalHeaders;
+    if (!bEncoded)
+    {
+        // Sending an empty body instead would let a write with missing data reach the server
+        FMasterHttpResult Result;
+        Result.FinalURL = Request.URL;
+        Result.StartTime = FPlatformTime::Seconds();
+        Result.LocalError = EHttpErrorKind::EncodeFailed;
+        Result.LocalErrorMessage = Body.IsValid()
+            ? FString::Printf(TEXT("Failed to serialize %s as the request body"), *Body.GetScriptStruct()->GetName())
+            : FString(TEXT("Request body struct is empty"));
+
+        UE_LOG(LogTemp, Error, TEXT("❌ HTTP Error: %s"), *Result.LocalErrorMessage);
+        AsyncTask(ENamedThreads::GameThread, [Result = MoveTemp(Result), OnComplete = MoveTemp(OnComplete)]() {
+            OnComplete(Result);
+        });
+        return FHttpRequestHandle();
+    }
 
-        // Add default JSON headers if not overridden
-        for (const auto& H : GetDefaultJsonHeaders())
-        {
-            FinalHeaders.Add(H.Key, H.Value);
-        }
+    return UMasterHttpClient::GetDefaultHttpClient()->ProcessRequest(MoveTemp(Request), false, MoveTemp(OnComplete));
+}
 
-        // Handle content type from options
-        FString ContentTypeValue;
-        switch (Options.ContentType)
-        {
-            case EContentType::ApplicationJson: ContentTypeValue = TEXT("application/json"); break;
-            case EContentType::ApplicationXml: ContentTypeValue = TEXT("application/xml"); break;
-            case EContentType::ApplicationFormEncoded: ContentTypeValue = TEXT("application/x-www-form-urlencoded"); break;
-            case EContentType::MultipartFormData: ContentTypeValue = TEXT("multipart/form-data"); break;
-            case EContentType::TextPlain: ContentTypeValue = TEXT("text/plain"); break;
-            case EContentType::TextHtml: ContentTypeValue = TEXT("text/html"); break;
-            case EContentType::TextXml: ContentTypeValue = TEXT("text/xml"); break;
-            case EContentType::Custom: ContentTypeValue = Options.CustomContentType; break;
-            default: ContentTypeValue = TEXT("application/json"); break;
-        }
-        if (!ContentTypeValue.IsEmpty())
-        {
-            FinalHeaders.Add(TEXT("Content-Type"), ContentTypeValue);
-        }
+bool UMasterHttpRequestBPLibrary::StructToJsonBody(const FInstancedStruct& Struct, FString& JsonBody)
+{
+    JsonBody.Reset();
+    return Struct.IsValid() && FJsonObjectConverter::UStructToJsonObjectString(Struct.GetScriptStruct(), Struct.GetMemory(), JsonBody, 0, 0, 0, nullptr, false);
+}
 
-        // Process enum-based headers with improved key mapping
-        for (const auto& H : DefaultHeaders)
-        {
-            FString KeyStr;
-            switch (H.Key)
-            {
-                case EHttpHeaderKey::Authorization: KeyStr = TEXT("Authorization"); break;
-                case EHttpHeaderKey::ContentType: KeyStr = TEXT("Content-Type"); break;
-                case EHttpHeaderKey::Accept: KeyStr = TEXT("Accept"); break;
-                case EHttpHeaderKey::UserAgent: KeyStr = TEXT("User-Agent"); break;
-                case EHttpHeaderKey::AcceptLanguage: KeyStr = TEXT("Accept-Language"); break;
-                case EHttpHeaderKey::AcceptEncoding: KeyStr = TEXT("Accept-Encoding"); break;
-                case EHttpHeaderKey::CacheControl: KeyStr = TEXT("Cache-Control"); break;
-                case EHttpHeaderKey::Connection: KeyStr = TEXT("Connection"); break;
-                case EHttpHeaderKey::Cookie: KeyStr = TEXT("Cookie"); break;
-                case EHttpHeaderKey::Host: KeyStr = TEXT("Host"); break;
-                case EHttpHeaderKey::Origin: KeyStr = TEXT("Origin"); break;
-                case EHttpHeaderKey::Referer: KeyStr = TEXT("Referer"); break;
-                case EHttpHeaderKey::XRequestedWith: KeyStr = TEXT("X-Requested-With"); break;
-                case EHttpHeaderKey::XApiKey: KeyStr = TEXT("X-API-Key"); break;
-                case EHttpHeaderKey::XAuthToken: KeyStr = TEXT("X-Auth-Token"); break;
-                case EHttpHeaderKey::XCSRFToken: KeyStr = TEXT("X-CSRF-Token"); break;
-                case EHttpHeaderKey::Custom: KeyStr = H.CustomKey; break;
-                default: continue;
-            }
-            if (!KeyStr.IsEmpty())
-            {
-                FinalHeaders.Add(KeyStr, H.Value);
-            }
-        }
+bool UMasterHttpRequestBPLibrary::SetJsonBodyFromStruct(FHttpRequestDescriptor& Request, const UScriptStruct* Struct, const void* Data)
+{
+    Request.JsonBody.Reset();
+    return Struct && Data && FJsonObjectConverter::UStructToJsonObjectString(Struct, Data, Request.JsonBody, 0, 0, 0, nullptr, false);
+}
 
-        // Add custom headers (these can override defaults)
-        for (const auto& H : CustomHeaders)
+FHttpRequestHandle UMasterHttpRequestBPLibrary::SendHttpRequestDecoded(
+    const FString& URL,
+    EHttpMethod Method,
+    TArray<FHttpHeaderEnumValue> DefaultHeaders,
+    TArray<FHttpKeyValue> CustomHeaders,
+    TArray<FHttpKeyValue> QueryParams,
+    TArray<FHttpKeyValue> Body,
+    UScriptStruct* ResponseStruct,
+    FHttpDecodedResponseDelegate Callback,
+    FHttpOptions Options)
+{
+    return SendHttpRequestDecodedNative(
+        MakeRequestDescriptor(URL, Method, MoveTemp(DefaultHeaders), MoveTemp(CustomHeaders), MoveTemp(QueryParams), MoveTemp(Body), MoveTemp(Options)),
+        ResponseStruct,
+        [Callback](const FHttpResponseSimple& Response, const FInstancedStruct& Decoded)
         {
-            FinalHeaders.Add(H.Key, H.Value);
-        }
+            Callback.ExecuteIfBound(Response, Decoded);
+        });
+}
 
-        // Apply all headers to request
-        for (const auto& Pair : FinalHeaders)
-        {
-            HttpRequest->SetHeader(Pair.Key, Pair.Value);
-        }
+FHttpRequestHandle UMasterHttpRequestBPLibrary::SendHttpRequestDecodedNative(
+    const FHttpRequestDescriptor& Request,
+    const UScriptStruct* ResponseStruct,
+    TFunction<void(const FHttpResponseSimple&, const FInstancedStruct&)> OnDecoded)
+{
+    TSharedPtr<const FHttpRequestDescriptor, ESPMode::ThreadSafe> DebugRequest;
+    if (Request.Options.DebugLevel != EDebugLevel::None)
+    {
+        DebugRequest = MakeShared<const FHttpRequestDescriptor, ESPMode::ThreadSafe>(Request);
+    }
 
-        // Handle request body for methods that support it
-        FString BodyString;
-        if (Verb == TEXT("POST") || Verb == TEXT("PUT") || Verb == TEXT("PATCH"))
-        {
-            if (Options.ContentType == EContentType::ApplicationFormEncoded)
-            {
-                // URL-encoded form data
-                TArray<FString> BodyPairs;
-                for (const auto& KV : Body)
-                {
-                    BodyPairs.Add(FGenericPlatformHttp::UrlEncode(KV.Key) + TEXT("=") + FGenericPlatformHttp::UrlEncode(KV.Value));
-                }
-                BodyString = FString::Join(BodyPairs, TEXT("&"));
-            }
-            else
-            {
-                // JSON body (default)
-                TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
-                for (const auto& KV : Body)
-                {
-                    JsonObject->SetStringField(KV.Key, KV.Value);
-                }
-                TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&BodyString);
-                FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
-            }
-            HttpRequest->SetContentAsString(BodyString);
-        }
+    // Complete on the HTTP thread so the body never touches the game thread
+    return UMasterHttpClient::GetDefaultHttpClient()->ProcessRequest(Request, true, [DebugRequest, ResponseStruct, OnDecoded = MoveTemp(OnDecoded)](const FMasterHttpResult& Result) {
+        // Hand the parse off to the thread pool so the HTTP thread keeps servicing other requests
+        Async(EAsyncExecution::ThreadPool, [DebugRequest, ResponseStruct, OnDecoded, Result]() {
+            const FHttpResponsePtr& Response = Result.Response;
+            FHttpResponseSimple RespData = MasterHttp::MakeResponse(Result, MasterHttp::EResponseBody::None);
+            FInstancedStruct Decoded;
 
-        // Apply advanced options
-        HttpRequest->SetTimeout(Options.TimeoutSeconds);
-
-        HttpRequest->OnProcessRequestComplete().BindLambda([=](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful) {
-            double EndTime = FPlatformTime::Seconds();
-            float Duration = static_cast<float>(EndTime - StartTime);
-
-            FHttpResponseSimple RespData;
-            RespData.bSuccess = bWasSuccessful && Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode());
-            RespData.Data = Response.IsValid() ? Response->GetContentAsString() : TEXT("");
-            RespData.StatusCode = Response.IsValid() ? Response->GetResponseCode() : -1;
-            RespData.StatusText = GetStatusText(RespData.StatusCode);
-            RespData.ErrorMessage = bWasSuccessful ? TEXT("") : (Response.IsValid() ? Response->GetContentAsString() : TEXT("Request failed - no response received"));
-            RespData.RequestDurationSeconds = Duration;
-            RespData.URL = FinalURL;
-            RespData.ContentLength = Response.IsValid() ? Response->GetContentLength() : 0;
-            RespData.ContentType = Response.IsValid() ? Response->GetContentType() : TEXT("");
-
-            if (Response.IsValid())
+            if (RespData.bSuccess && ResponseStruct)
             {
-                for (const auto& Header : Response->GetAllHeaders())
+                const TArray<uint8>& Content = Response->GetContent();
+                FUtf8StringView JsonView(reinterpret_cast<const UTF8CHAR*>(Content.GetData()), Content.Num());
+                TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(JsonView);
+                TSharedPtr<FJsonObject> JsonObject;
+                if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
                 {
-                    FString Key, Value;
-                    if (Header.Split(TEXT(": "), &Key, &Value))
+                    Decoded.InitializeAs(ResponseStruct);
+                    if (!FJsonObjectConverter::JsonObjectToUStruct(JsonObject.ToSharedRef(), ResponseStruct, Decoded.GetMutableMemory()))
                     {
-                        RespData.Headers.Add(MakeKeyValue(Key, Value));
+                        Decoded.Reset();
                     }
                 }
             }
 
-            // Enhanced debug logging
-            if (Options.DebugLevel != EDebugLevel::None)
+            if (RespData.bSuccess && !Decoded.IsValid())
+            {
+                // Keep the raw body around only when it could not be mapped, so callers can inspect it
+                RespData.Data = Response->GetContentAsString();
+                RespData.ErrorMessage = FString::Printf(TEXT("Failed to decode response into %s"), ResponseStruct ? *ResponseStruct->GetName() : TEXT("None"));
+                RespData.ErrorKind = EHttpErrorKind::DecodeFailed;
+            }
+
+            if (DebugRequest.IsValid())
             {
-                LogDebugInfo(FinalURL, Method, QueryParams, CustomHeaders, Body, RespData, Options);
+                LogDebugInfo(Result.FinalURL, DebugRequest->Method, DebugRequest->QueryParams, DebugRequest->CustomHeaders, DebugRequest->Body, RespData, DebugRequest->Options);
             }
 
-            Callback.ExecuteIfBound(RespData);
+            AsyncTask(ENamedThreads::GameThread, [OnDecoded, RespData = MoveTemp(RespData), Decoded = MoveTemp(Decoded)]() {
+                OnDecoded(RespData, Decoded);
+            });
+        });
+    });
+}
+
+FHttpRequestHandle UMasterHttpRequestBPLibrary::SendHttpRequestBatch(
+    const TArray<FHttpRequestDescriptor>& Requests,
+    FHttpBatchDelegate Callback,
+    int32 MaxConcurrency,
+    bool bFailFast,
+    FName Tag)
+{
+    return MasterHttp::SendBatch(UMasterHttpClient::GetDefaultHttpClient(), Requests, MaxConcurrency, bFailFast, Tag, [Callback = MoveTemp(Callback)](const FHttpBatchResult& Result) {
+        Callback.ExecuteIfBound(Result);
+    });
+}
+
+FHttpRequestHandle UMasterHttpRequestBPLibrary::DownloadToFile(
+    const FString& URL,
+    const FString& FilePath,
+    TArray<FHttpHeaderEnumValue> DefaultHeaders,
+    TArray<FHttpKeyValue> CustomHeaders,
+    bool bResume,
+    FHttpProgressDelegate OnProgress,
+    FHttpResponseDelegate Callback,
+    FHttpOptions Options)
+{
+    MasterHttp::FTransferProgress Progress;
+    if (OnProgress.IsBound())
+    {
+        Progress = [OnProgress](int64 BytesTransferred, int64 TotalBytes) {
+            OnProgress.ExecuteIfBound(BytesTransferred, TotalBytes);
+        };
+    }
+
+    return MasterHttp::DownloadToFile(
+        UMasterHttpClient::GetDefaultHttpClient(),
+        MakeRequestDescriptor(URL, EHttpMethod::GET, MoveTemp(DefaultHeaders), MoveTemp(CustomHeaders), {}, {}, MoveTemp(Options)),
+        FilePath,
+        bResume,
+        MoveTemp(Progress),
+        [Callback](const FHttpResponseSimple& Response) {
+            Callback.ExecuteIfBound(Response);
+        });
+}
+
+FHttpRequestHandle UMasterHttpRequestBPLibrary::UploadFile(
+    const FString& URL,
+    EHttpMethod Method,
+    const FString& FilePath,
+    TArray<FHttpHeaderEnumValue> DefaultHeaders,
+    TArray<FHttpKeyValue> CustomHeaders,
+    TArray<FHttpKeyValue> QueryParams,
+    FHttpProgressDelegate OnProgress,
+    FHttpResponseDelegate Callback,
+    FHttpOptions Options)
+{
+    MasterHttp::FTransferProgress Progress;
+    if (OnProgress.IsBound())
+    {
+        Progress = [OnProgress](int64 BytesTransferred, int64 TotalBytes) {
+            OnProgress.ExecuteIfBound(BytesTransferred, TotalBytes);
+        };
+    }
+
+    return MasterHttp::UploadFile(
+        UMasterHttpClient::GetDefaultHttpClient(),
+        MakeRequestDescriptor(URL, Method, MoveTemp(DefaultHeaders), MoveTemp(CustomHeaders), MoveTemp(QueryParams), {}, MoveTemp(Options)),
+        FilePath,
+        MoveTemp(Progress),
+        [Callback](const FHttpResponseSimple& Response) {
+            Callback.ExecuteIfBound(Response);
+        });
+}
+
+FHttpRequestHandle UMasterHttpRequestBPLibrary::SendMultipartRequest(
+    const FString& URL,
+    EHttpMethod Method,
+    TArray<FHttpHeaderEnumValue> DefaultHeaders,
+    TArray<FHttpKeyValue> CustomHeaders,
+    TArray<FHttpKeyValue> QueryParams,
+    TArray<FHttpMultipartPart> Parts,
+    FHttpProgressDelegate OnProgress,
+    FHttpResponseDelegate Callback,
+    FHttpOptions Options)
+{
+    MasterHttp::FTransferProgress Progress;
+    if (OnProgress.IsBound())
+    {
+        Progress = [OnProgress](int64 BytesTransferred, int64 TotalBytes) {
+            OnProgress.ExecuteIfBound(BytesTransferred, TotalBytes);
+        };
+    }
+
+    return MasterHttp::SendMultipart(
+        UMasterHttpClient::GetDefaultHttpClient(),
+        MakeRequestDescriptor(URL, Method, MoveTemp(DefaultHeaders), MoveTemp(CustomHeaders), MoveTemp(QueryParams), {}, MoveTemp(Options)),
+        Parts,
+        MoveTemp(Progress),
+        [Callback](const FHttpResponseSimple& Response) {
+            Callback.ExecuteIfBound(Response);
         });
+}
 
-        HttpRequest->ProcessRequest();
-    };
+FHttpRequestHandle UMasterHttpRequestBPLibrary::OpenEventStream(
+    const FString& URL,
+    TArray<FHttpHeaderEnumValue> DefaultHeaders,
+    TArray<FHttpKeyValue> CustomHeaders,
+    TArray<FHttpKeyValue> QueryParams,
+    FHttpServerEventDelegate OnEvent,
+    FHttpResponseDelegate OnClosed,
+    FHttpStreamOptions StreamOptions,
+    FHttpOptions Options)
+{
+    return MasterHttp::OpenEventStream(
+        UMasterHttpClient::GetDefaultHttpClient(),
+        MakeRequestDescriptor(URL, EHttpMethod::GET, MoveTemp(DefaultHeaders), MoveTemp(CustomHeaders), MoveTemp(QueryParams), {}, MoveTemp(Options)),
+        StreamOptions,
+        [OnEvent](const FHttpServerEvent& Event) {
+            OnEvent.ExecuteIfBound(Event);
+        },
+        [OnClosed](const FHttpResponseSimple& Response) {
+            OnClosed.ExecuteIfBound(Response);
+        });
+}
 
-    Async(EAsyncExecution::TaskGraph, RequestLambda);
+FHttpRequestHandle UMasterHttpRequestBPLibrary::StreamHttpRequest(
+    const FString& URL,
+    EHttpMethod Method,
+    TArray<FHttpHeaderEnumValue> DefaultHeaders,
+    TArray<FHttpKeyValue> CustomHeaders,
+    TArray<FHttpKeyValue> QueryParams,
+    const FString& JsonBody,
+    FHttpStreamChunkDelegate OnChunk,
+    FHttpResponseDelegate Callback,
+    FHttpStreamOptions StreamOptions,
+    FHttpOptions Options)
+{
+    FHttpRequestDescriptor Request = MakeRequestDescriptor(URL, Method, MoveTemp(DefaultHeaders), MoveTemp(CustomHeaders), MoveTemp(QueryParams), {}, MoveTemp(Options));
+    Request.JsonBody = JsonBody;
+
+    return MasterHttp::StreamResponse(
+        UMasterHttpClient::GetDefaultHttpClient(),
+        MoveTemp(Request),
+        StreamOptions,
+        [OnChunk](const FString& Chunk) {
+            OnChunk.ExecuteIfBound(Chunk);
+        },
+        [Callback](const FHttpResponseSimple& Response) {
+            Callback.ExecuteIfBound(Response);
+        });
+}
+
+FHttpMultipartPart UMasterHttpRequestBPLibrary::MakeMultipartField(const FString& Name, const FString& Value)
+{
+    FHttpMultipartPart Part;
+    Part.Name = Name;
+    Part.Value = Value;
+    return Part;
+}
+
+FHttpMultipartPart UMasterHttpRequestBPLibrary::MakeMultipartFile(const FString& Name, const FString& FilePath, const FString& FileName, const FString& ContentType)
+{
+    FHttpMultipartPart Part;
+    Part.Name = Name;
+    Part.FilePath = FilePath;
+    Part.FileName = FileName;
+    Part.ContentType = ContentType;
+    return Part;
+}
+
+FHttpRequestDescriptor UMasterHttpRequestBPLibrary::MakeRequestDescriptor(
+    const FString& URL,
+    EHttpMethod Method,
+    TArray<FHttpHeaderEnumValue> DefaultHeaders,
+    TArray<FHttpKeyValue> CustomHeaders,
+    TArray<FHttpKeyValue> QueryParams,
+    TArray<FHttpKeyValue> Body,
+    FHttpOptions Options)
+{
+    FHttpRequestDescriptor Request;
+    Request.URL = URL;
+    Request.Method = Method;
+    Request.DefaultHeaders = MoveTemp(DefaultHeaders);
+    Request.CustomHeaders = MoveTemp(CustomHeaders);
+    Request.QueryParams = MoveTemp(QueryParams);
+    Request.Body = MoveTemp(Body);
+    Request.Options = MoveTemp(Options);
+    return Request;
 }
 
 void UMasterHttpRequestBPLibrary::DecodeJson(const FString& JsonString, const FString& KeyPath, EJsonDecodeResult& Result, FString& Value, TArray<FHttpKeyValue>& ObjectFields, TArray<FString>& ArrayValues)
 {
+    MASTERHTTP_SCOPE(DecodeJson);
+
     Result = EJsonDecodeResult::Failed;
     Value = TEXT("");
     ObjectFields.Empty();
     ArrayValues.Empty();
 
-    TSharedPtr<FJsonObject> JsonObject;
+    TSharedPtr<FJsonValue> RootValue;
     TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    if (!FJsonSerializer::Deserialize(Reader, RootValue) || !RootValue.IsValid())
+        return;
+
+    TArray<MasterHttp::FJsonPathSegment> Segments;
+    if (!MasterHttp::ParseJsonPath(KeyPath, Segments))
         return;
 
-    if (KeyPath.IsEmpty())
+    // Wildcard paths ("items[*].id") return every match as an array value
+    const bool bWildcard = Segments.ContainsByPredicate([](const MasterHttp::FJsonPathSegment& Segment)
     {
-        // If KeyPath is empty, decode the root object and fill ObjectFields
-        if (JsonObject->Values.Num() > 0)
+        return Segment.Kind == MasterHttp::FJsonPathSegment::EKind::Wildcard;
+    });
+    if (bWildcard)
+    {
+        const MasterHttp::FJsonPathQuery PathQuery({ KeyPath });
+        PathQuery.Evaluate(RootValue, [&ArrayValues](int32, const TSharedPtr<FJsonValue>& Match)
         {
-            for (const auto& Pair : JsonObject->Values)
-            {
-                FString FieldValue;
-                switch (Pair.Value->Type)
-                {
-                    case EJson::String:
-                        FieldValue = Pair.Value->AsString();
-                        break;
-                    case EJson::Number:
-                        FieldValue = FString::SanitizeFloat(Pair.Value->AsNumber());
-                        break;
-                    case EJson::Boolean:
-                        FieldValue = Pair.Value->AsBool() ? TEXT("true") : TEXT("false");
-                        break;
-                    case EJson::Object:
-                    {
-                        FString ObjectJson;
-                        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ObjectJson);
-                        FJsonSerializer::Serialize(Pair.Value->AsObject().ToSharedRef(), Writer);
-                        FieldValue = ObjectJson;
-                        break;
-                    }
-                    case EJson::Array:
-                    {
-                        FString ArrayJson;
-                        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ArrayJson);
-                        FJsonSerializer::Serialize(Pair.Value->AsArray(), Writer);
-                        FieldValue = ArrayJson;
-                        break;
-                    }
-                    default:
-                        FieldValue = TEXT("");
-                        break;
-                }
-                ObjectFields.Add(MakeKeyValue(Pair.Key, FieldValue));
-            }
-            Result = EJsonDecodeResult::ObjectFields;
-        }
+            ArrayValues.Add(UMasterJsonDocument::JsonValueToString(Match));
+        });
+        Result = EJsonDecodeResult::ArrayValues;
         return;
     }
 
-    TArray<FString> Keys;
-    KeyPath.ParseIntoArray(Keys, TEXT("."), true);
-    TSharedPtr<FJsonObject> CurrentObj = JsonObject;
-    TSharedPtr<FJsonValue> CurrentVal;
-    for (int32 i = 0; i < Keys.Num(); ++i)
+    TSharedPtr<FJsonValue> CurrentVal = RootValue;
+    for (const MasterHttp::FJsonPathSegment& Segment : Segments)
     {
-        CurrentVal = CurrentObj->TryGetField(Keys[i]);
+        CurrentVal = MasterHttp::ResolveJsonSegment(CurrentVal, Segment);
         if (!CurrentVal.IsValid())
             return;
-        if (i == Keys.Num() - 1)
+    }
+
+    switch (CurrentVal->Type)
+    {
+        case EJson::String:
+        case EJson::Number:
+        case EJson::Boolean:
+            Value = UMasterJsonDocument::JsonValueToString(CurrentVal);
+            Result = EJsonDecodeResult::Value;
+            break;
+        case EJson::Object:
         {
-            switch (CurrentVal->Type)
+            // An empty root object keeps returning Failed, as it always has
+            const TSharedPtr<FJsonObject>& Obj = CurrentVal->AsObject();
+            if (Segments.Num() == 0 && Obj->Values.Num() == 0)
+                break;
+            ObjectFields.Reserve(Obj->Values.Num());
+            for (const auto& Pair : Obj->Values)
             {
-                case EJson::String:
-                    Value = CurrentVal->AsString();
-                    Result = EJsonDecodeResult::Value;
-                    break;
-                case EJson::Number:
-                    Value = FString::SanitizeFloat(CurrentVal->AsNumber());
-                    Result = EJsonDecodeResult::Value;
-                    break;
-                case EJson::Boolean:
-                    Value = CurrentVal->AsBool() ? TEXT("true") : TEXT("false");
-                    Result = EJsonDecodeResult::Value;
-                    break;
-                case EJson::Object:
-                {
-                    TSharedPtr<FJsonObject> Obj = CurrentVal->AsObject();
-                    for (const auto& Pair : Obj->Values)
-                    {
-                        FString FieldValue;
-                        if (Pair.Value->Type == EJson::String)
-                            FieldValue = Pair.Value->AsString();
-                        else if (Pair.Value->Type == EJson::Number)
-                            FieldValue = FString::SanitizeFloat(Pair.Value->AsNumber());
-                        else if (Pair.Value->Type == EJson::Boolean)
-                            FieldValue = Pair.Value->AsBool() ? TEXT("true") : TEXT("false");
-                        else
-                        {
-                            TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&FieldValue);
-                            if (Pair.Value->Type == EJson::Object)
-                                FJsonSerializer::Serialize(Pair.Value->AsObject().ToSharedRef(), Writer);
-                            else if (Pair.Value->Type == EJson::Array)
-                                FJsonSerializer::Serialize(Pair.Value->AsArray(), Writer);
-                        }
-                        ObjectFields.Add(MakeKeyValue(Pair.Key, FieldValue));
-                    }
-                    Result = EJsonDecodeResult::ObjectFields;
-                    break;
-                }
-                case EJson::Array:
-                {
-                    const TArray<TSharedPtr<FJsonValue>>& Arr = CurrentVal->AsArray();
-                    for (const auto& Elem : Arr)
-                    {
-                        FString ObjectJson;
-                        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ObjectJson);
-                        FJsonSerializer::Serialize(Elem->AsObject().ToSharedRef(), Writer);
-                        ArrayValues.Add(ObjectJson);
-                    }
-                    Result = EJsonDecodeResult::ArrayValues;
-                    break;
-                }
-                default:
-                    Result = EJsonDecodeResult::Failed;
-                    break;
+                ObjectFields.Add(MakeKeyValue(Pair.Key, UMasterJsonDocument::JsonValueToString(Pair.Value)));
             }
+            Result = EJsonDecodeResult::ObjectFields;
+            break;
         }
-        else
+        case EJson::Array:
         {
-            if (CurrentVal->Type == EJson::Object)
-                CurrentObj = CurrentVal->AsObject();
-            else
-                return;
+            // Scalars come back as their string form, objects and arrays as JSON
+            const TArray<TSharedPtr<FJsonValue>>& Arr = CurrentVal->AsArray();
+            ArrayValues.Reserve(Arr.Num());
+            for (const auto& Elem : Arr)
+            {
+                ArrayValues.Add(UMasterJsonDocument::JsonValueToString(Elem));
+            }
+            Result = EJsonDecodeResult::ArrayValues;
+            break;
         }
+        default:
+            break;
     }
 }
 
 void UMasterHttpRequestBPLibrary::LogDebugInfo(const FString& URL, EHttpMethod Method, const TArray<FHttpKeyValue>& QueryParams, const TArray<FHttpKeyValue>& Headers, const TArray<FHttpKeyValue>& Body, const FHttpResponseSimple& Response, const FHttpOptions& Options)
 {
+    MASTERHTTP_SCOPE(LogDebugInfo);
+
     FString MethodStr = StaticEnum<EHttpMethod>()->GetDisplayNameTextByValue(static_cast<int64>(Method)).ToString();
 
     // Basic console logging for all debug levels
@@ -379,143 +562,162 @@ void UMasterHttpRequestBPLibrary::LogDebugInfo(const FString& URL, EHttpMethod M
         }
     }
 
-    // Detailed logging (console + file)
+    // Detailed logging (console + file): capture what the report needs and let the debug log thread format and write it
     if (Options.DebugLevel >= EDebugLevel::Detailed)
     {
-        FString DebugInfo;
-        DebugInfo += TEXT("===============================================\n");
-        DebugInfo += TEXT("🌐 HTTP REQUEST DEBUG REPORT\n");
-        DebugInfo += TEXT("===============================================\n");
-        DebugInfo += FString::Printf(TEXT("⏰ Timestamp: %s\n"), *FDateTime::Now().ToString(TEXT("%Y-%m-%d %H:%M:%S")));
-        DebugInfo += FString::Printf(TEXT("🎯 URL: %s\n"), *URL);
-        DebugInfo += FString::Printf(TEXT("📋 Method: %s\n"), *MethodStr);
-        DebugInfo += FString::Printf(TEXT("⏱️ Duration: %.2f seconds\n"), Response.RequestDurationSeconds);
-        DebugInfo += TEXT("\n");
-
-        if (QueryParams.Num() > 0)
+        TUniquePtr<FMasterHttpDebugRecord> Record = MakeUnique<FMasterHttpDebugRecord>();
+        Record->Timestamp = FDateTime::Now();
+        Record->URL = URL;
+        Record->Method = MoveTemp(MethodStr);
+        Record->QueryParams = QueryParams;
+        Record->RequestHeaders = Headers;
+        Record->Body = Body;
+        Record->StatusCode = Response.StatusCode;
+        Record->StatusText = Response.StatusText;
+        Record->ErrorMessage = Response.ErrorMessage;
+        Record->ContentType = Response.ContentType;
+        Record->ContentLength = Response.ContentLength;
+        Record->DurationSeconds = Response.RequestDurationSeconds;
+        Record->bSuccess = Response.bSuccess;
+
+        if (Options.DebugLevel == EDebugLevel::Verbose)
         {
-            DebugInfo += TEXT("🔍 QUERY PARAMETERS:\n");
-            for (const auto& Q : QueryParams)
+            Record->ResponseHeaders = GetResponseHeaders(Response);
+            if (!Response.Data.IsEmpty())
             {
-                DebugInfo += FString::Printf(TEXT("   %s = %s\n"), *Q.Key, *Q.Value);
+                Record->DataPreview = Response.Data.Len() > 1000 ? Response.Data.Left(1000) + TEXT("... (truncated)") : Response.Data;
             }
-            DebugInfo += TEXT("\n");
+            Record->RawBytes = Response.Content.Num();
         }
 
-        if (Headers.Num() > 0)
-        {
-            DebugInfo += TEXT("📝 REQUEST HEADERS:\n");
-            for (const auto& H : Headers)
-            {
-                DebugInfo += FString::Printf(TEXT("   %s: %s\n"), *H.Key, *H.Value);
-            }
-            DebugInfo += TEXT("\n");
-        }
+        FMasterHttpRequestModule::Get().GetDebugLog()->Enqueue(MoveTemp(Record));
+    }
+}
 
-        if (Body.Num() > 0)
-        {
-            DebugInfo += TEXT("📦 REQUEST BODY:\n");
-            for (const auto& B : Body)
-            {
-                DebugInfo += FString::Printf(TEXT("   %s: %s\n"), *B.Key, *B.Value);
-            }
-            DebugInfo += TEXT("\n");
-        }
+// Metrics
+TArray<FHttpMetricsEntry> UMasterHttpRequestBPLibrary::GetHttpMetrics(bool bPerRoute)
+{
+    return FMasterHttpRequestModule::Get().GetMetrics()->GetSnapshot(bPerRoute);
+}
 
-        DebugInfo += TEXT("📡 RESPONSE:\n");
-        DebugInfo += FString::Printf(TEXT("   Status: %d %s\n"), Response.StatusCode, *Response.StatusText);
-        DebugInfo += FString::Printf(TEXT("   Success: %s\n"), Response.bSuccess ? TEXT("✅ Yes") : TEXT("❌ No"));
-        DebugInfo += FString::Printf(TEXT("   Content Length: %d bytes\n"), Response.ContentLength);
-        DebugInfo += FString::Printf(TEXT("   Content Type: %s\n"), *Response.ContentType);
+void UMasterHttpRequestBPLibrary::ResetHttpMetrics()
+{
+    FMasterHttpRequestModule::Get().GetMetrics()->Reset();
+}
 
-        if (!Response.ErrorMessage.IsEmpty())
-        {
-            DebugInfo += FString::Printf(TEXT("   Error: %s\n"), *Response.ErrorMessage);
-        }
+void UMasterHttpRequestBPLibrary::SetHttpMetricsExport(float IntervalSeconds, EHttpMetricsExportFormat Format)
+{
+    FMasterHttpRequestModule::Get().GetMetrics()->SetPeriodicExport(IntervalSeconds, Format);
+}
 
-        if (Response.Headers.Num() > 0 && Options.DebugLevel == EDebugLevel::Verbose)
-        {
-            DebugInfo += TEXT("\n📝 RESPONSE HEADERS:\n");
-            for (const auto& H : Response.Headers)
-            {
-                DebugInfo += FString::Printf(TEXT("   %s: %s\n"), *H.Key, *H.Value);
-            }
-        }
+FString UMasterHttpRequestBPLibrary::ExportHttpMetrics(EHttpMetricsExportFormat Format)
+{
+    return FMasterHttpRequestModule::Get().GetMetrics()->Export(Format);
+}
 
-        if (!Response.Data.IsEmpty() && Options.DebugLevel == EDebugLevel::Verbose)
-        {
-            DebugInfo += TEXT("\n📄 RESPONSE DATA:\n");
-            FString TruncatedData = Response.Data.Len() > 1000 ? Response.Data.Left(1000) + TEXT("... (truncated)") : Response.Data;
-            DebugInfo += TruncatedData + TEXT("\n");
-        }
+void UMasterHttpRequestBPLibrary::SetHttpDebugLogSettings(EHttpDebugLogFormat Format, int32 MaxFileSizeMB, int32 MaxFiles)
+{
+    FMasterHttpRequestModule::Get().GetDebugLog()->SetSettings(Format, static_cast<int64>(FMath::Max(1, MaxFileSizeMB)) * 1024 * 1024, MaxFiles);
+}
 
-        DebugInfo += TEXT("===============================================\n");
+FString UMasterHttpRequestBPLibrary::GetHttpDebugLogPath()
+{
+    return FMasterHttpRequestModule::Get().GetDebugLog()->GetLogFilePath();
+}
 
-        // Console output for detailed
-        UE_LOG(LogTemp, Log, TEXT("%s"), *DebugInfo);
+// Quick HTTP Methods
+FHttpRequestHandle UMasterHttpRequestBPLibrary::QuickGet(const FString& URL, FHttpResponseDelegate Callback, FHttpOptions Options)
+{
+    return SendHttpRequest(URL, EHttpMethod::GET, {}, {}, {}, {}, Callback, Options);
+}
 
-        // File output
-        FString Timestamp = FDateTime::Now().ToString(TEXT("%Y-%m-%d_%H-%M-%S"));
-        FString SlugifiedURL = URL;
-        SlugifiedURL.ReplaceInline(TEXT("//"), TEXT("_"));
-        SlugifiedURL.ReplaceInline(TEXT("/"), TEXT("_"));
-        SlugifiedURL.ReplaceInline(TEXT(":"), TEXT("_"));
-        SlugifiedURL.ReplaceInline(TEXT("?"), TEXT("_"));
-        SlugifiedURL.ReplaceInline(TEXT("&"), TEXT("_"));
-        SlugifiedURL.ReplaceInline(TEXT("="), TEXT("_"));
+FHttpRequestHandle UMasterHttpRequestBPLibrary::QuickPost(const FString& URL, const FString& JsonBody, FHttpResponseDelegate Callback, FHttpOptions Options)
+{
+    // The caller's JSON goes out untouched: no parse, no flattening of nested values into strings
+    return SendHttpRequestJson(URL, EHttpMethod::POST, {}, {}, {}, JsonBody, Callback, Options);
+}
 
-        FString StatusPrefix = Response.bSuccess ? TEXT("SUCCESS") : TEXT("ERROR");
-        FString FileName = FString::Printf(TEXT("%s_%s_%s_%s_%d.txt"), *StatusPrefix, *SlugifiedURL, *MethodStr, *Timestamp, Response.StatusCode);
-        FString FileDirectory = FPaths::ProjectSavedDir() + TEXT("/MasterHttpDebug");
-        FString FullPath = FileDirectory + TEXT("/") + FileName;
+// Scheduler
+FHttpSchedulerStats UMasterHttpRequestBPLibrary::GetHttpSchedulerStats()
+{
+    return FMasterHttpRequestModule::Get().GetScheduler()->GetStats();
+}
 
-        if (!FPaths::DirectoryExists(FileDirectory))
-        {
-            FPlatformFileManager::Get().GetPlatformFile().CreateDirectoryTree(*FileDirectory);
-        }
+void UMasterHttpRequestBPLibrary::SetHttpSchedulerLimits(int32 MaxInFlight, int32 MaxPerHost, int32 MaxBackgroundInFlight)
+{
+    FMasterHttpRequestModule::Get().GetScheduler()->SetLimits(MaxInFlight, MaxPerHost, MaxBackgroundInFlight);
+}
 
-        FFileHelper::SaveStringToFile(DebugInfo, *FullPath);
+void UMasterHttpRequestBPLibrary::SetHttpHostConcurrencyLimit(const FString& Host, int32 MaxConcurrent)
+{
+    FMasterHttpRequestModule::Get().GetScheduler()->SetHostLimit(Host, MaxConcurrent);
+}
 
-        UE_LOG(LogTemp, Log, TEXT("💾 Debug log saved to: %s"), *FullPath);
-    }
+void UMasterHttpRequestBPLibrary::SetHttpRateLimit(const FString& Host, float RequestsPerSecond, int32 Burst)
+{
+    FMasterHttpRequestModule::Get().GetHostGuard()->SetRateLimit(Host, RequestsPerSecond, Burst);
 }
 
-// Quick HTTP Methods
-void UMasterHttpRequestBPLibrary::QuickGet(const FString& URL, FHttpResponseDelegate Callback, FHttpOptions Options)
+void UMasterHttpRequestBPLibrary::SetHttpCircuitBreaker(int32 FailureThreshold, float OpenSeconds)
 {
-    SendHttpRequest(URL, EHttpMethod::GET, {}, {}, {}, {}, Callback, Options);
+    FMasterHttpRequestModule::Get().GetHostGuard()->SetCircuitBreaker(FailureThreshold, OpenSeconds);
 }
 
-void UMasterHttpRequestBPLibrary::QuickPost(const FString& URL, const FString& JsonBody, FHttpResponseDelegate Callback, FHttpOptions Options)
+EHttpCircuitState UMasterHttpRequestBPLibrary::GetHttpCircuitState(const FString& Host)
 {
-    TSharedPtr<FJsonObject> JsonObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonBody);
+    return FMasterHttpRequestModule::Get().GetHostGuard()->GetCircuitState(Host);
+}
 
-    TArray<FHttpKeyValue> Body;
-    if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
-    {
-        for (const auto& Pair : JsonObject->Values)
-        {
-            FString Value;
-            if (Pair.Value->Type == EJson::String)
-                Value = Pair.Value->AsString();
-            else if (Pair.Value->Type == EJson::Number)
-                Value = FString::SanitizeFloat(Pair.Value->AsNumber());
-            else if (Pair.Value->Type == EJson::Boolean)
-                Value = Pair.Value->AsBool() ? TEXT("true") : TEXT("false");
-            else
-            {
-                TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Value);
-                if (Pair.Value->Type == EJson::Object)
-                    FJsonSerializer::Serialize(Pair.Value->AsObject().ToSharedRef(), Writer);
-                else if (Pair.Value->Type == EJson::Array)
-                    FJsonSerializer::Serialize(Pair.Value->AsArray(), Writer);
-            }
-            Body.Add(MakeKeyValue(Pair.Key, Value));
-        }
-    }
+int64 UMasterHttpRequestBPLibrary::GetCoalescedRequestCount()
+{
+    return FMasterHttpRequestModule::Get().GetCoalescer()->GetCoalescedCount();
+}
+
+// Handles
+bool UMasterHttpRequestBPLibrary::CancelHttpRequest(const FHttpRequestHandle& Handle)
+{
+    return Handle.IsValid() && Handle.State->Cancel();
+}
+
+int32 UMasterHttpRequestBPLibrary::CancelHttpRequestsByTag(FName Tag)
+{
+    return FMasterHttpRequestModule::Get().GetRequestRegistry()->CancelByTag(Tag);
+}
 
-    SendHttpRequest(URL, EHttpMethod::POST, {}, {}, {}, Body, Callback, Options);
+int32 UMasterHttpRequestBPLibrary::CancelAllHttpRequests()
+{
+    return FMasterHttpRequestModule::Get().GetRequestRegistry()->CancelAll();
+}
+
+EHttpRequestState UMasterHttpRequestBPLibrary::GetHttpRequestState(const FHttpRequestHandle& Handle)
+{
+    return Handle.IsValid() ? Handle.State->State.load() : EHttpRequestState::None;
+}
+
+float UMasterHttpRequestBPLibrary::GetHttpRequestProgress(const FHttpRequestHandle& Handle, int64& BytesSent, int64& BytesReceived, int64& BytesExpected)
+{
+    BytesSent = Handle.IsValid() ? Handle.State->BytesSent.load() : 0;
+    BytesReceived = Handle.IsValid() ? Handle.State->BytesReceived.load() : 0;
+    BytesExpected = Handle.IsValid() ? Handle.State->BytesExpected.load() : 0;
+    if (Handle.IsValid() && Handle.State->State.load() == EHttpRequestState::Succeeded)
+        return 1.0f;
+    return BytesExpected > 0 ? FMath::Clamp(static_cast<float>(BytesReceived) / BytesExpected, 0.0f, 1.0f) : -1.0f;
+}
+
+int32 UMasterHttpRequestBPLibrary::GetActiveHttpRequestCount(FName Tag)
+{
+    return FMasterHttpRequestModule::Get().GetRequestRegistry()->GetActiveCount(Tag);
+}
+
+// Cache
+FHttpCacheStats UMasterHttpRequestBPLibrary::GetHttpCacheStats()
+{
+    return FMasterHttpRequestModule::Get().GetResponseCache()->GetStats();
+}
+
+void UMasterHttpRequestBPLibrary::ClearHttpResponseCache(bool bIncludeDisk)
+{
+    FMasterHttpRequestModule::Get().GetResponseCache()->Clear(bIncludeDisk);
 }
 
 // Helper Functions
@@ -540,18 +742,8 @@ FHttpHeaderEnumValue UMasterHttpRequestBPLibrary::MakeContentTypeHeader(EContent
     FHttpHeaderEnumValue Header;
     Header.Key = EHttpHeaderKey::ContentType;
 
-    switch (ContentType)
-    {
-        case EContentType::ApplicationJson: Header.Value = TEXT("application/json"); break;
-        case EContentType::ApplicationXml: Header.Value = TEXT("application/xml"); break;
-        case EContentType::ApplicationFormEncoded: Header.Value = TEXT("application/x-www-form-urlencoded"); break;
-        case EContentType::MultipartFormData: Header.Value = TEXT("multipart/form-data"); break;
-        case EContentType::TextPlain: Header.Value = TEXT("text/plain"); break;
-        case EContentType::TextHtml: Header.Value = TEXT("text/html"); break;
-        case EContentType::TextXml: Header.Value = TEXT("text/xml"); break;
-        case EContentType::Custom: Header.Value = CustomType; break;
-        default: Header.Value = TEXT("application/json"); break;
-    }
+    const TCHAR* ContentTypeValue = MasterHttp::GetContentTypeString(ContentType);
+    Header.Value = ContentTypeValue ? FString(ContentTypeValue) : CustomType;
 
     return Header;
 }
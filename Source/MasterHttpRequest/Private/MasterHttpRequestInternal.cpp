@@ -0,0 +1,344 @@
+/*
+==========================================================================================
+File: MasterHttpRequestInternal.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterHttpRequestInternal.h"
+#include "MasterHttpTrace.h"
+#include "HttpModule.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+namespace MasterHttp
+{
+    // Lookup tables indexed by enum value, so building a request never runs string switches or comparisons
+    static constexpr const TCHAR* VerbTable[] =
+    {
+        TEXT("GET"),
+        TEXT("POST"),
+        TEXT("PUT"),
+        TEXT("DELETE"),
+        TEXT("PATCH")
+    };
+    static_assert(UE_ARRAY_COUNT(VerbTable) == static_cast<SIZE_T>(EHttpMethod::PATCH) + 1, "VerbTable must match EHttpMethod");
+
+    static constexpr bool MethodHasBodyTable[] =
+    {
+        false,  // GET
+        true,   // POST
+        true,   // PUT
+        false,  // DELETE
+        true    // PATCH
+    };
+    static_assert(UE_ARRAY_COUNT(MethodHasBodyTable) == UE_ARRAY_COUNT(VerbTable), "MethodHasBodyTable must match EHttpMethod");
+
+    static constexpr const TCHAR* HeaderKeyTable[] =
+    {
+        nullptr,                    // None
+        TEXT("Authorization"),
+        TEXT("Content-Type"),
+        TEXT("Accept"),
+        TEXT("User-Agent"),
+        TEXT("Accept-Language"),
+        TEXT("Accept-Encoding"),
+        TEXT("Cache-Control"),
+        TEXT("Connection"),
+        TEXT("Cookie"),
+        TEXT("Host"),
+        TEXT("Origin"),
+        TEXT("Referer"),
+        TEXT("X-Requested-With"),
+        TEXT("X-API-Key"),
+        TEXT("X-Auth-Token"),
+        TEXT("X-CSRF-Token"),
+        nullptr                     // Custom
+    };
+    static_assert(UE_ARRAY_COUNT(HeaderKeyTable) == static_cast<SIZE_T>(EHttpHeaderKey::Custom) + 1, "HeaderKeyTable must match EHttpHeaderKey");
+
+    static constexpr const TCHAR* ContentTypeTable[] =
+    {
+        TEXT("application/json"),
+        TEXT("application/xml"),
+        TEXT("application/x-www-form-urlencoded"),
+        TEXT("multipart/form-data"),
+        TEXT("text/plain"),
+        TEXT("text/html"),
+        TEXT("text/xml"),
+        TEXT("application/octet-stream"),
+        nullptr                     // Custom
+    };
+    static_assert(UE_ARRAY_COUNT(ContentTypeTable) == static_cast<SIZE_T>(EContentType::Custom) + 1, "ContentTypeTable must match EContentType");
+
+    const TCHAR* GetVerbString(EHttpMethod Method)
+    {
+        const SIZE_T Index = static_cast<SIZE_T>(Method);
+        return Index < UE_ARRAY_COUNT(VerbTable) ? VerbTable[Index] : VerbTable[0];
+    }
+
+    const TCHAR* GetHeaderKeyString(EHttpHeaderKey Key)
+    {
+        const SIZE_T Index = static_cast<SIZE_T>(Key);
+        return Index < UE_ARRAY_COUNT(HeaderKeyTable) ? HeaderKeyTable[Index] : nullptr;
+    }
+
+    const TCHAR* GetContentTypeString(EContentType ContentType)
+    {
+        const SIZE_T Index = static_cast<SIZE_T>(ContentType);
+        return Index < UE_ARRAY_COUNT(ContentTypeTable) ? ContentTypeTable[Index] : ContentTypeTable[0];
+    }
+
+    bool MethodHasBody(EHttpMethod Method)
+    {
+        const SIZE_T Index = static_cast<SIZE_T>(Method);
+        return Index < UE_ARRAY_COUNT(MethodHasBodyTable) && MethodHasBodyTable[Index];
+    }
+}
+
+void MasterHttp::BuildFinalURL(const FHttpRequestDescriptor& Request, FString& OutFinalURL)
+{
+    OutFinalURL.Reset(Request.URL.Len() + Request.QueryParams.Num() * 32);
+    OutFinalURL += Request.URL;
+    if (Request.QueryParams.Num() > 0)
+    {
+        TCHAR Separator = Request.URL.Contains(TEXT("?")) ? TEXT('&') : TEXT('?');
+        for (const auto& Param : Request.QueryParams)
+        {
+            OutFinalURL.AppendChar(Separator);
+            OutFinalURL += FGenericPlatformHttp::UrlEncode(Param.Key);
+            OutFinalURL.AppendChar(TEXT('='));
+            OutFinalURL += FGenericPlatformHttp::UrlEncode(Param.Value);
+            Separator = TEXT('&');
+        }
+    }
+}
+
+FString MasterHttp::FindRequestHeader(const FHttpRequestDescriptor& Request, const FString& HeaderName)
+{
+    // Later headers win, custom headers override enum headers, which override the defaults
+    for (int32 Index = Request.CustomHeaders.Num() - 1; Index >= 0; --Index)
+    {
+        if (Request.CustomHeaders[Index].Key.Equals(HeaderName, ESearchCase::IgnoreCase))
+            return Request.CustomHeaders[Index].Value;
+    }
+
+    for (int32 Index = Request.DefaultHeaders.Num() - 1; Index >= 0; --Index)
+    {
+        const FHttpHeaderEnumValue& H = Request.DefaultHeaders[Index];
+        const TCHAR* KeyStr = H.Key == EHttpHeaderKey::Custom ? *H.CustomKey : GetHeaderKeyString(H.Key);
+        if (KeyStr && HeaderName.Equals(KeyStr, ESearchCase::IgnoreCase))
+            return H.Value;
+    }
+
+    if (HeaderName.Equals(TEXT("Accept"), ESearchCase::IgnoreCase))
+        return TEXT("application/json");
+
+    if (HeaderName.Equals(TEXT("Content-Type"), ESearchCase::IgnoreCase))
+    {
+        const TCHAR* ContentTypeValue = GetContentTypeString(Request.Options.ContentType);
+        return ContentTypeValue ? FString(ContentTypeValue) : (Request.Options.CustomContentType.IsEmpty() ? FString(TEXT("application/json")) : Request.Options.CustomContentType);
+    }
+
+    return FString();
+}
+
+FString MasterHttp::BuildBodyString(const FHttpRequestDescriptor& Request)
+{
+    MASTERHTTP_SCOPE(SerializeBody);
+
+    if (!Request.JsonBody.IsEmpty())
+        return Request.JsonBody;
+
+    FString BodyString;
+    if (Request.Options.ContentType == EContentType::ApplicationFormEncoded)
+    {
+        // URL-encoded form data
+        for (const auto& KV : Request.Body)
+        {
+            if (!BodyString.IsEmpty())
+            {
+                BodyString.AppendChar(TEXT('&'));
+            }
+            BodyString += FGenericPlatformHttp::UrlEncode(KV.Key);
+            BodyString.AppendChar(TEXT('='));
+            BodyString += FGenericPlatformHttp::UrlEncode(KV.Value);
+        }
+    }
+    else
+    {
+        // JSON body (default), written straight to the output without an intermediate FJsonObject
+        int32 EstimatedLen = 2;
+        for (const auto& KV : Request.Body)
+        {
+            EstimatedLen += KV.Key.Len() + KV.Value.Len() + 6;
+        }
+        BodyString.Reserve(EstimatedLen);
+
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&BodyString);
+        Writer->WriteObjectStart();
+        for (const auto& KV : Request.Body)
+        {
+            Writer->WriteValue(KV.Key, KV.Value);
+        }
+        Writer->WriteObjectEnd();
+        Writer->Close();
+    }
+    return BodyString;
+}
+
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> MasterHttp::BuildRequest(const FHttpRequestDescriptor& Request, FString& OutFinalURL)
+{
+    MASTERHTTP_SCOPE(BuildRequest);
+
+    const FHttpOptions& Options = Request.Options;
+    BuildFinalURL(Request, OutFinalURL);
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+    HttpRequest->SetURL(OutFinalURL);
+    HttpRequest->SetVerb(GetVerbString(Request.Method));
+
+    // Headers are applied in override order; SetHeader replaces an existing value with the same name,
+    // so no intermediate map is needed: JSON defaults, then the content type option, enum headers, custom headers.
+    {
+        MASTERHTTP_SCOPE(BuildHeaders);
+        HttpRequest->SetHeader(TEXT("Accept"), TEXT("application/json"));
+        if (Options.bDecompressResponses)
+        {
+            HttpRequest->SetHeader(TEXT("Accept-Encoding"), TEXT("gzip, deflate"));
+        }
+
+        const TCHAR* ContentTypeValue = GetContentTypeString(Options.ContentType);
+        if (ContentTypeValue)
+        {
+            HttpRequest->SetHeader(TEXT("Content-Type"), ContentTypeValue);
+        }
+        else
+        {
+            HttpRequest->SetHeader(TEXT("Content-Type"), Options.CustomContentType.IsEmpty() ? TEXT("application/json") : *Options.CustomContentType);
+        }
+
+        for (const auto& H : Request.DefaultHeaders)
+        {
+            if (H.Key == EHttpHeaderKey::Custom)
+            {
+                if (!H.CustomKey.IsEmpty())
+                {
+                    HttpRequest->SetHeader(H.CustomKey, H.Value);
+                }
+            }
+            else if (const TCHAR* KeyStr = GetHeaderKeyString(H.Key))
+            {
+                HttpRequest->SetHeader(KeyStr, H.Value);
+            }
+        }
+
+        for (const auto& H : Request.CustomHeaders)
+        {
+            HttpRequest->SetHeader(H.Key, H.Value);
+        }
+    }
+
+    // Handle request body for methods that support it
+    if (MethodHasBody(Request.Method) && Request.BinaryBody.Num() > 0)
+    {
+        // Raw bytes go out untouched
+        HttpRequest->SetContent(Request.BinaryBody);
+    }
+    else if (MethodHasBody(Request.Method) && !Request.JsonBody.IsEmpty())
+    {
+        // Caller-provided JSON goes out untouched
+        HttpRequest->SetContentAsString(Request.JsonBody);
+    }
+    else if (MethodHasBody(Request.Method))
+    {
+        HttpRequest->SetContentAsString(BuildBodyString(Request));
+    }
+
+    // Apply advanced options
+    HttpRequest->SetTimeout(Options.TimeoutSeconds);
+
+    return HttpRequest;
+}
+
+FHttpResponseSimple MasterHttp::MakeResponse(const FMasterHttpResult& Result, EResponseBody BodyMode, bool bSplitHeaders)
+{
+    MASTERHTTP_SCOPE(MakeResponse);
+
+    const FHttpResponsePtr& Response = Result.Response;
+    const bool bWasSuccessful = Result.bWasSuccessful;
+
+    FHttpResponseSimple RespData;
+    RespData.bSuccess = bWasSuccessful && Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode());
+    if (Response.IsValid() && BodyMode == EResponseBody::String)
+    {
+        RespData.Data = Response->GetContentAsString();
+    }
+    else if (Response.IsValid() && BodyMode == EResponseBody::Raw)
+    {
+        RespData.Content = Response->GetContent();
+    }
+    RespData.StatusCode = Response.IsValid() ? Response->GetResponseCode() : -1;
+    RespData.StatusText = UMasterHttpRequestBPLibrary::GetStatusText(RespData.StatusCode);
+    RespData.ErrorMessage = bWasSuccessful ? TEXT("") : (Response.IsValid() ? Response->GetContentAsString() : TEXT("Request failed - no response received"));
+    RespData.RequestDurationSeconds = static_cast<float>(FPlatformTime::Seconds() - Result.StartTime);
+    RespData.URL = Result.FinalURL;
+    RespData.Attempts = Result.Attempts;
+    RespData.RequestId = Result.RequestId;
+
+    const int64 BodyBytes = Response.IsValid() ? Response->GetContent().Num() : 0;
+    RespData.BytesSent = Result.BytesSent;
+    RespData.BytesSentUncompressed = Result.BytesSentUncompressed >= 0 ? Result.BytesSentUncompressed : Result.BytesSent;
+    RespData.BytesReceived = Result.BytesReceived >= 0 ? Result.BytesReceived : BodyBytes;
+    RespData.BytesReceivedUncompressed = BodyBytes;
+
+    RespData.Timing = Result.Timing;
+    if (Result.SubmitTime > 0.0)
+    {
+        const double Now = FPlatformTime::Seconds();
+        RespData.Timing.TotalSeconds = static_cast<float>(Now - Result.SubmitTime);
+        RespData.Timing.DeliverySeconds = Result.CompletedTime > 0.0 ? static_cast<float>(Now - Result.CompletedTime) : 0.0f;
+    }
+
+    if (Result.LocalError != EHttpErrorKind::None)
+    {
+        RespData.ErrorKind = Result.LocalError;
+        RespData.ErrorMessage = Result.LocalErrorMessage;
+    }
+    else if (!RespData.bSuccess)
+    {
+        RespData.ErrorKind = Response.IsValid() && bWasSuccessful ? EHttpErrorKind::HttpStatus : EHttpErrorKind::ConnectionFailed;
+    }
+    RespData.ContentLength = Response.IsValid() ? Response->GetContentLength() : 0;
+    RespData.ContentType = Response.IsValid() ? Response->GetContentType() : TEXT("");
+
+    if (Response.IsValid() && bSplitHeaders)
+    {
+        SplitHeaders(Response->GetAllHeaders(), RespData.Headers);
+    }
+    else if (Response.IsValid())
+    {
+        RespData.RawHeaderLines = MakeShared<const TArray<FString>, ESPMode::ThreadSafe>(Response->GetAllHeaders());
+    }
+
+    return RespData;
+}
+
+void MasterHttp::SplitHeaders(const TArray<FString>& HeaderLines, TArray<FHttpKeyValue>& OutHeaders)
+{
+    MASTERHTTP_SCOPE(SplitHeaders);
+
+    OutHeaders.Reserve(OutHeaders.Num() + HeaderLines.Num());
+    for (const FString& Header : HeaderLines)
+    {
+        int32 Colon = INDEX_NONE;
+        if (Header.FindChar(TEXT(':'), Colon))
+        {
+            FHttpKeyValue& Pair = OutHeaders.AddDefaulted_GetRef();
+            Pair.Key = Header.Left(Colon);
+            Pair.Value = Header.RightChop(Colon + 1).TrimStart();
+        }
+    }
+}
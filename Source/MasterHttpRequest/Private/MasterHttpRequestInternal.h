@@ -0,0 +1,69 @@
+/*
+==========================================================================================
+File: MasterHttpRequestInternal.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "MasterHttpRequestBPLibrary.h"
+#include "MasterHttpClient.h"
+
+/** Request plumbing shared by the Blueprint library and the other plugin entry points (internal use). */
+namespace MasterHttp
+{
+    /** Verb string for a method, from a compile-time table. */
+    const TCHAR* GetVerbString(EHttpMethod Method);
+
+    /** Header name for an enum-based header, or nullptr for None / Custom. */
+    const TCHAR* GetHeaderKeyString(EHttpHeaderKey Key);
+
+    /** MIME type for a content type, or nullptr for Custom. */
+    const TCHAR* GetContentTypeString(EContentType ContentType);
+
+    /** Whether requests with this method carry a body. */
+    bool MethodHasBody(EHttpMethod Method);
+
+    /** Append the URL-encoded query parameters of a request to its URL. */
+    void BuildFinalURL(const FHttpRequestDescriptor& Request, FString& OutFinalURL);
+
+    /** Value a header will have on the built request (same override order as BuildRequest), or empty. */
+    FString FindRequestHeader(const FHttpRequestDescriptor& Request, const FString& HeaderName);
+
+    /** The request's JsonBody when set; otherwise a form-encoded or JSON body string for its Body fields, per its content type. */
+    FString BuildBodyString(const FHttpRequestDescriptor& Request);
+
+    /**
+    * Create and configure an engine HTTP request (URL, verb, headers, body, timeout).
+    * @param OutFinalURL - The URL including the encoded query string.
+    */
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> BuildRequest(const FHttpRequestDescriptor& Request, FString& OutFinalURL);
+
+    /** How MakeResponse copies the response body. */
+    enum class EResponseBody : uint8
+    {
+        None,       // Leave Data and Content empty
+        String,     // Convert into Data
+        Raw         // Copy the bytes into Content without conversion
+    };
+
+    /** Body mode requested by a set of options. */
+    inline EResponseBody GetResponseBodyMode(const FHttpOptions& Options)
+    {
+        return Options.bRawResponse ? EResponseBody::Raw : EResponseBody::String;
+    }
+
+    /**
+    * Convert an engine response into the Blueprint-facing response struct.
+    * @param bSplitHeaders - Fill Headers; otherwise only the raw header lines are kept, for GetResponseHeader.
+    */
+    FHttpResponseSimple MakeResponse(const FMasterHttpResult& Result, EResponseBody BodyMode = EResponseBody::String, bool bSplitHeaders = true);
+
+    /** Split "Name: Value" header lines into key-value pairs. */
+    void SplitHeaders(const TArray<FString>& HeaderLines, TArray<FHttpKeyValue>& OutHeaders);
+}
@@ -0,0 +1,138 @@
+/*
+==========================================================================================
+File: MasterHttpRequestRegistry.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterHttpRequestRegistry.h"
+
+bool FMasterHttpRequestState::Cancel()
+{
+    FHttpRequestPtr InFlight;
+    TFunction<void()> CancelQueued;
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (IsFinished() || bCancelRequested.load())
+            return false;
+        bCancelRequested = true;
+        InFlight = HttpRequest;
+        CancelQueued = OnCancel;
+    }
+
+    // Outside the lock: the engine may complete the request synchronously from CancelRequest
+    if (InFlight.IsValid())
+    {
+        InFlight->CancelRequest();
+    }
+    else if (CancelQueued)
+    {
+        CancelQueued();
+    }
+    return true;
+}
+
+void FMasterHttpRequestState::SetOnCancel(TFunction<void()> InOnCancel)
+{
+    FScopeLock ScopeLock(&Lock);
+    OnCancel = MoveTemp(InOnCancel);
+}
+
+bool FMasterHttpRequestState::IsFinished() const
+{
+    const EHttpRequestState Current = State.load();
+    return Current == EHttpRequestState::Succeeded || Current == EHttpRequestState::Failed || Current == EHttpRequestState::Cancelled;
+}
+
+bool FMasterHttpRequestState::StartAttempt(const FHttpRequestRef& InHttpRequest, TFunctionRef<void()> Process)
+{
+    FScopeLock ScopeLock(&Lock);
+    if (bCancelRequested.load())
+        return false;
+
+    HttpRequest = InHttpRequest;
+    State = EHttpRequestState::InFlight;
+    Process();
+    return true;
+}
+
+void FMasterHttpRequestState::EndAttempt()
+{
+    FScopeLock ScopeLock(&Lock);
+    HttpRequest.Reset();
+    State = EHttpRequestState::Queued;
+}
+
+bool FMasterHttpRequestState::Finish(bool bSucceeded)
+{
+    FScopeLock ScopeLock(&Lock);
+    HttpRequest.Reset();
+    OnCancel = nullptr;
+
+    const bool bCancelled = bCancelRequested.load();
+    State = bCancelled ? EHttpRequestState::Cancelled : (bSucceeded ? EHttpRequestState::Succeeded : EHttpRequestState::Failed);
+    return bCancelled;
+}
+
+FMasterHttpRequestStateRef FMasterHttpRequestRegistry::Register(int64 RequestId, FName Tag)
+{
+    FMasterHttpRequestStateRef State = MakeShared<FMasterHttpRequestState, ESPMode::ThreadSafe>(RequestId, Tag);
+
+    FScopeLock ScopeLock(&Lock);
+    Active.Add(RequestId, State);
+    return State;
+}
+
+void FMasterHttpRequestRegistry::Unregister(int64 RequestId)
+{
+    FScopeLock ScopeLock(&Lock);
+    Active.Remove(RequestId);
+}
+
+int32 FMasterHttpRequestRegistry::CancelByTag(FName Tag)
+{
+    if (Tag.IsNone())
+        return 0;
+
+    int32 Cancelled = 0;
+    for (const FMasterHttpRequestStateRef& State : Collect(Tag))
+    {
+        Cancelled += State->Cancel() ? 1 : 0;
+    }
+    return Cancelled;
+}
+
+int32 FMasterHttpRequestRegistry::CancelAll()
+{
+    int32 Cancelled = 0;
+    for (const FMasterHttpRequestStateRef& State : Collect(NAME_None))
+    {
+        Cancelled += State->Cancel() ? 1 : 0;
+    }
+    return Cancelled;
+}
+
+int32 FMasterHttpRequestRegistry::GetActiveCount(FName Tag) const
+{
+    if (Tag.IsNone())
+    {
+        FScopeLock ScopeLock(&Lock);
+        return Active.Num();
+    }
+    return Collect(Tag).Num();
+}
+
+TArray<FMasterHttpRequestStateRef> FMasterHttpRequestRegistry::Collect(FName Tag) const
+{
+    TArray<FMasterHttpRequestStateRef> Result;
+
+    FScopeLock ScopeLock(&Lock);
+    Result.Reserve(Active.Num());
+    for (const TPair<int64, FMasterHttpRequestStateRef>& Entry : Active)
+    {
+        if (Tag.IsNone() || Entry.Value->Tag == Tag)
+            Result.Add(Entry.Value);
+    }
+    return Result;
+}
@@ -0,0 +1,101 @@
+/*
+==========================================================================================
+File: MasterHttpRequestRegistry.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "MasterHttpRequestBPLibrary.h"
+#include <atomic>
+
+/**
+ * Live state of one submitted request, shared by the pipeline and every FHttpRequestHandle that refers to it.
+ * Safe to use from any thread.
+ */
+struct FMasterHttpRequestState
+{
+    FMasterHttpRequestState(int64 InRequestId, FName InTag)
+        : RequestId(InRequestId)
+        , Tag(InTag)
+    {
+    }
+
+    const int64 RequestId;
+    const FName Tag;
+
+    std::atomic<EHttpRequestState> State{EHttpRequestState::Queued};
+    std::atomic<int64> BytesSent{0};
+    std::atomic<int64> BytesReceived{0};
+    std::atomic<int64> BytesExpected{0};        // Response Content-Length, 0 until known
+
+    /**
+    * Ask for the request to be cancelled. An engine request in flight is cancelled right away; otherwise OnCancel
+    * takes it out of the queue. Either way the callback still runs once, with ErrorKind Cancelled.
+    * @return False if the request already finished or was already cancelled.
+    */
+    bool Cancel();
+
+    bool IsCancelRequested() const { return bCancelRequested.load(); }
+    bool IsFinished() const;
+
+    /**
+    * Run Process while holding the lock that Cancel uses, with the engine request recorded as in flight,
+    * unless cancellation was already requested. Returns false in that case, without calling Process.
+    */
+    bool StartAttempt(const FHttpRequestRef& HttpRequest, TFunctionRef<void()> Process);
+
+    /** Forget the engine request of a failed attempt while the request waits to be retried. */
+    void EndAttempt();
+
+    /**
+    * Move to a terminal state right before the callback runs.
+    * @return True if the request was cancelled first, in which case the callback must report Cancelled.
+    */
+    bool Finish(bool bSucceeded);
+
+    /** Set by the pipeline: takes a request that is not on the wire out of the queue and completes it (any thread). */
+    void SetOnCancel(TFunction<void()> InOnCancel);
+
+private:
+    mutable FCriticalSection Lock;
+    FHttpRequestPtr HttpRequest;
+    TFunction<void()> OnCancel;
+    std::atomic<bool> bCancelRequested{false};
+};
+
+using FMasterHttpRequestStateRef = TSharedRef<FMasterHttpRequestState, ESPMode::ThreadSafe>;
+
+/**
+ * Requests that have been submitted and have not called back yet, for cancellation by tag or all at once.
+ * Owned by FMasterHttpRequestModule; safe to use from any thread.
+ */
+class FMasterHttpRequestRegistry
+{
+public:
+    /** Create and track the state of a new request. */
+    FMasterHttpRequestStateRef Register(int64 RequestId, FName Tag);
+
+    /** Stop tracking a request once its callback is dispatched. */
+    void Unregister(int64 RequestId);
+
+    /** Cancel every live request with this tag. Returns how many were cancelled. */
+    int32 CancelByTag(FName Tag);
+
+    /** Cancel every live request. Returns how many were cancelled. */
+    int32 CancelAll();
+
+    /** Live requests with this tag, or all of them when Tag is None. */
+    int32 GetActiveCount(FName Tag) const;
+
+private:
+    /** Snapshot the matching states, so cancellation runs outside the lock. */
+    TArray<FMasterHttpRequestStateRef> Collect(FName Tag) const;
+
+    mutable FCriticalSection Lock;
+    TMap<int64, FMasterHttpRequestStateRef> Active;
+};
@@ -0,0 +1,80 @@
+/*
+==========================================================================================
+File: MasterHttpRetry.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterHttpRetry.h"
+
+bool MasterHttp::IsIdempotent(EHttpMethod Method)
+{
+    return Method == EHttpMethod::GET || Method == EHttpMethod::PUT || Method == EHttpMethod::DELETE;
+}
+
+bool MasterHttp::IsRetryableFailure(const FHttpResponsePtr& Response, bool bWasSuccessful)
+{
+    if (!bWasSuccessful || !Response.IsValid())
+        return true;
+
+    switch (Response->GetResponseCode())
+    {
+        case 408: // Request Timeout
+        case 429: // Too Many Requests
+        case 502: // Bad Gateway
+        case 503: // Service Unavailable
+        case 504: // Gateway Timeout
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool MasterHttp::ParseRetryAfter(const FString& RetryAfter, double& OutSeconds)
+{
+    const FString Value = RetryAfter.TrimStartAndEnd();
+    if (Value.IsEmpty())
+        return false;
+
+    if (Value.IsNumeric())
+    {
+        OutSeconds = FMath::Max(0.0, FCString::Atod(*Value));
+        return true;
+    }
+
+    FDateTime RetryAt;
+    if (FDateTime::ParseHttpDate(Value, RetryAt))
+    {
+        OutSeconds = FMath::Max(0.0, (RetryAt - FDateTime::UtcNow()).GetTotalSeconds());
+        return true;
+    }
+    return false;
+}
+
+bool MasterHttp::GetRetryDelay(EHttpMethod Method, const FHttpOptions& Options, int32 AttemptsMade, const FHttpResponsePtr& Response, bool bWasSuccessful, float& OutDelaySeconds)
+{
+    if (AttemptsMade >= Options.MaxAttempts)
+        return false;
+
+    if (Options.bRetryIdempotentOnly && !IsIdempotent(Method))
+        return false;
+
+    if (!IsRetryableFailure(Response, bWasSuccessful))
+        return false;
+
+    // Full jitter: anywhere between zero and the exponential cap
+    const float Exponent = static_cast<float>(FMath::Clamp(AttemptsMade - 1, 0, 30));
+    const float Cap = FMath::Min(Options.RetryMaxDelaySeconds, Options.RetryBaseDelaySeconds * FMath::Pow(2.0f, Exponent));
+    OutDelaySeconds = FMath::FRandRange(0.0f, FMath::Max(Cap, 0.0f));
+
+    double RetryAfterSeconds = 0.0;
+    if (Options.bHonorRetryAfter && Response.IsValid() && ParseRetryAfter(Response->GetHeader(TEXT("Retry-After")), RetryAfterSeconds))
+    {
+        if (RetryAfterSeconds > Options.RetryMaxDelaySeconds)
+            return false;
+
+        OutDelaySeconds = FMath::Max(OutDelaySeconds, static_cast<float>(RetryAfterSeconds));
+    }
+    return true;
+}
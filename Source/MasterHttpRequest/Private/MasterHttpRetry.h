@@ -0,0 +1,35 @@
+/*
+==========================================================================================
+File: MasterHttpRetry.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpResponse.h"
+#include "MasterHttpRequestBPLibrary.h"
+
+/** Retry policy driven by FHttpOptions (internal use). */
+namespace MasterHttp
+{
+    /** Whether repeating a request with this method has the same effect as sending it once. */
+    bool IsIdempotent(EHttpMethod Method);
+
+    /** Whether a finished attempt failed in a way worth retrying (no response, 408, 429, 502, 503, 504). */
+    bool IsRetryableFailure(const FHttpResponsePtr& Response, bool bWasSuccessful);
+
+    /** Seconds requested by a Retry-After header (delta-seconds or HTTP date). False if absent or invalid. */
+    bool ParseRetryAfter(const FString& RetryAfter, double& OutSeconds);
+
+    /**
+    * Decide whether to retry after an attempt and how long to wait first.
+    * The delay uses full jitter, a random value between 0 and min(RetryMaxDelaySeconds, RetryBaseDelaySeconds * 2^(attempt - 1)),
+    * so clients that failed together do not retry together. A Retry-After header raises the delay to at least the requested
+    * time; if the server asks for longer than RetryMaxDelaySeconds, the request is not retried.
+    * @param AttemptsMade - Attempts finished so far, including this one.
+    */
+    bool GetRetryDelay(EHttpMethod Method, const FHttpOptions& Options, int32 AttemptsMade, const FHttpResponsePtr& Response, bool bWasSuccessful, float& OutDelaySeconds);
+}
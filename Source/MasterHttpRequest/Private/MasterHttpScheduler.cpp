@@ -0,0 +1,243 @@
+/*
+==========================================================================================
+File: MasterHttpScheduler.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterHttpScheduler.h"
+
+void FMasterHttpScheduler::Enqueue(FMasterHttpScheduledRequest&& Request)
+{
+    TArray<TFunction<void()>> ToStart;
+    {
+        FScopeLock ScopeLock(&Lock);
+        Request.EnqueueTime = FPlatformTime::Seconds();
+
+        const int32 QueueIndex = static_cast<int32>(Request.Priority);
+        Queues[QueueIndex].Add(MoveTemp(Request));
+
+        int32 QueueDepth = 0;
+        for (const TArray<FMasterHttpScheduledRequest>& Queue : Queues)
+        {
+            QueueDepth += Queue.Num();
+        }
+        PeakQueueDepth = FMath::Max(PeakQueueDepth, QueueDepth);
+
+        CollectStartable(ToStart);
+    }
+
+    for (TFunction<void()>& Start : ToStart)
+    {
+        Start();
+    }
+}
+
+bool FMasterHttpScheduler::Remove(int64 RequestId)
+{
+    FScopeLock ScopeLock(&Lock);
+    for (TArray<FMasterHttpScheduledRequest>& Queue : Queues)
+    {
+        const int32 Index = Queue.IndexOfByPredicate([RequestId](const FMasterHttpScheduledRequest& Request) {
+            return Request.RequestId == RequestId;
+        });
+        if (Index != INDEX_NONE)
+        {
+            Queue.RemoveAt(Index, 1, EAllowShrinking::No);
+            return true;
+        }
+    }
+    return false;
+}
+
+void FMasterHttpScheduler::OnRequestFinished(const FString& Host, EHttpRequestPriority Priority)
+{
+    TArray<TFunction<void()>> ToStart;
+    {
+        FScopeLock ScopeLock(&Lock);
+        --InFlight;
+        if (Priority == EHttpRequestPriority::Background)
+        {
+            --BackgroundInFlight;
+        }
+        if (int32* Active = ActivePerHost.Find(Host))
+        {
+            if (--(*Active) <= 0)
+            {
+                ActivePerHost.Remove(Host);
+            }
+        }
+        if (Priority == EHttpRequestPriority::Critical)
+        {
+            if (int32* Active = ActiveCriticalPerHost.Find(Host))
+            {
+                if (--(*Active) <= 0)
+                {
+                    ActiveCriticalPerHost.Remove(Host);
+                }
+            }
+        }
+
+        CollectStartable(ToStart);
+    }
+
+    for (TFunction<void()>& Start : ToStart)
+    {
+        Start();
+    }
+}
+
+void FMasterHttpScheduler::CollectStartable(TArray<TFunction<void()>>& OutStart)
+{
+    const double Now = FPlatformTime::Seconds();
+    for (TArray<FMasterHttpScheduledRequest>& Queue : Queues)
+    {
+        for (int32 Index = 0; Index < Queue.Num();)
+        {
+            // Skip requests whose host is full instead of blocking everything queued behind them
+            if (!CanStart(Queue[Index]))
+            {
+                ++Index;
+                continue;
+            }
+
+            FMasterHttpScheduledRequest Request = MoveTemp(Queue[Index]);
+            Queue.RemoveAt(Index, 1, EAllowShrinking::No);
+
+            MarkStarted(Request);
+            const double Waited = Now - Request.EnqueueTime;
+            TotalQueueWaitSeconds += Waited;
+            MaxQueueWaitSeconds = FMath::Max(MaxQueueWaitSeconds, Waited);
+            OutStart.Add(MoveTemp(Request.Start));
+        }
+    }
+}
+
+bool FMasterHttpScheduler::CanStart(const FMasterHttpScheduledRequest& Request) const
+{
+    // Critical requests ignore the global cap
+    if (Request.Priority != EHttpRequestPriority::Critical && InFlight >= MaxInFlight)
+        return false;
+
+    if (Request.Priority == EHttpRequestPriority::Background && BackgroundInFlight >= MaxBackgroundInFlight)
+        return false;
+
+    int32 HostLimit = GetHostLimit(Request.Host);
+    if (Request.MaxPerHost > 0)
+    {
+        HostLimit = FMath::Min(HostLimit, Request.MaxPerHost);
+    }
+
+    // Critical requests are only counted against each other, so a host full of bulk traffic cannot hold them back
+    const TMap<FString, int32>& Counted = Request.Priority == EHttpRequestPriority::Critical ? ActiveCriticalPerHost : ActivePerHost;
+    const int32* Active = Counted.Find(Request.Host);
+    return !Active || *Active < HostLimit;
+}
+
+void FMasterHttpScheduler::MarkStarted(const FMasterHttpScheduledRequest& Request)
+{
+    ++InFlight;
+    ++TotalStarted;
+    if (Request.Priority == EHttpRequestPriority::Background)
+    {
+        ++BackgroundInFlight;
+    }
+    ++ActivePerHost.FindOrAdd(Request.Host);
+    if (Request.Priority == EHttpRequestPriority::Critical)
+    {
+        ++ActiveCriticalPerHost.FindOrAdd(Request.Host);
+    }
+}
+
+int32 FMasterHttpScheduler::GetHostLimit(const FString& Host) const
+{
+    const int32* Limit = HostLimits.Find(Host);
+    return Limit ? *Limit : MaxPerHost;
+}
+
+void FMasterHttpScheduler::SetLimits(int32 InMaxInFlight, int32 InMaxPerHost, int32 InMaxBackgroundInFlight)
+{
+    TArray<TFunction<void()>> ToStart;
+    {
+        FScopeLock ScopeLock(&Lock);
+        MaxInFlight = FMath::Max(1, InMaxInFlight);
+        MaxPerHost = FMath::Max(1, InMaxPerHost);
+        MaxBackgroundInFlight = FMath::Clamp(InMaxBackgroundInFlight, 1, MaxInFlight);
+
+        // Raising a limit may free slots for queued requests
+        CollectStartable(ToStart);
+    }
+
+    for (TFunction<void()>& Start : ToStart)
+    {
+        Start();
+    }
+}
+
+void FMasterHttpScheduler::SetHostLimit(const FString& Host, int32 InMaxPerHost)
+{
+    TArray<TFunction<void()>> ToStart;
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (InMaxPerHost > 0)
+        {
+            HostLimits.Add(Host, InMaxPerHost);
+        }
+        else
+        {
+            HostLimits.Remove(Host);
+        }
+        CollectStartable(ToStart);
+    }
+
+    for (TFunction<void()>& Start : ToStart)
+    {
+        Start();
+    }
+}
+
+int32 FMasterHttpScheduler::GetHostLimitOverride(const FString& Host) const
+{
+    FScopeLock ScopeLock(&Lock);
+    const int32* Limit = HostLimits.Find(Host);
+    return Limit ? *Limit : 0;
+}
+
+FHttpSchedulerStats FMasterHttpScheduler::GetStats() const
+{
+    FScopeLock ScopeLock(&Lock);
+
+    FHttpSchedulerStats Stats;
+    Stats.InFlight = InFlight;
+    Stats.QueuedCritical = Queues[static_cast<int32>(EHttpRequestPriority::Critical)].Num();
+    Stats.QueuedNormal = Queues[static_cast<int32>(EHttpRequestPriority::Normal)].Num();
+    Stats.QueuedBackground = Queues[static_cast<int32>(EHttpRequestPriority::Background)].Num();
+    Stats.QueueDepth = Stats.QueuedCritical + Stats.QueuedNormal + Stats.QueuedBackground;
+    Stats.PeakQueueDepth = PeakQueueDepth;
+    Stats.TotalStarted = TotalStarted;
+    Stats.AverageQueueWaitSeconds = TotalStarted > 0 ? static_cast<float>(TotalQueueWaitSeconds / TotalStarted) : 0.0f;
+    Stats.MaxQueueWaitSeconds = static_cast<float>(MaxQueueWaitSeconds);
+    return Stats;
+}
+
+int32 FMasterHttpScheduler::GetActiveRequestCount(const FString& Host) const
+{
+    FScopeLock ScopeLock(&Lock);
+    const int32* Active = ActivePerHost.Find(Host);
+    return Active ? *Active : 0;
+}
+
+int32 FMasterHttpScheduler::GetQueuedRequestCount(const FString& Host) const
+{
+    FScopeLock ScopeLock(&Lock);
+    int32 Count = 0;
+    for (const TArray<FMasterHttpScheduledRequest>& Queue : Queues)
+    {
+        for (const FMasterHttpScheduledRequest& Request : Queue)
+        {
+            Count += Request.Host == Host ? 1 : 0;
+        }
+    }
+    return Count;
+}
@@ -0,0 +1,95 @@
+/*
+==========================================================================================
+File: MasterHttpScheduler.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MasterHttpRequestBPLibrary.h"
+
+/** A request waiting for a slot. Start is called (outside the scheduler lock) once a slot is granted. */
+struct FMasterHttpScheduledRequest
+{
+    FString Host;
+    EHttpRequestPriority Priority = EHttpRequestPriority::Normal;
+    int64 RequestId = 0;                    // Used by Remove
+
+    /** Extra per-host cap from the issuing client, compared with all active requests to the host (0 = only the scheduler's host limit applies). */
+    int32 MaxPerHost = 0;
+
+    double EnqueueTime = 0.0;
+    TFunction<void()> Start;
+};
+
+/**
+ * Stage in front of IHttpRequest::ProcessRequest that bounds how much traffic is in flight.
+ * - A global in-flight cap (Critical requests are exempt so they never wait behind bulk traffic).
+ * - Per-host caps, with a default and optional overrides per host. Critical requests are counted only against
+ *   other Critical requests to the host, so a host busy with Normal/Background traffic may briefly exceed its cap.
+ * - Background requests may only use a fraction of the global slots.
+ * Queues are served highest priority first; a request whose host is full does not block others behind it.
+ * Owned by FMasterHttpRequestModule; safe to use from any thread.
+ */
+class FMasterHttpScheduler
+{
+public:
+    /** Queue a request, or start it immediately if a slot is free. */
+    void Enqueue(FMasterHttpScheduledRequest&& Request);
+
+    /**
+    * Take a queued request out of its queue without starting it (cancellation).
+    * @return False if it is not queued: it already started, or was never enqueued.
+    */
+    bool Remove(int64 RequestId);
+
+    /** Must be called exactly once for every started request when it finishes. Starts queued requests. */
+    void OnRequestFinished(const FString& Host, EHttpRequestPriority Priority);
+
+    void SetLimits(int32 InMaxInFlight, int32 InMaxPerHost, int32 InMaxBackgroundInFlight);
+    void SetHostLimit(const FString& Host, int32 MaxPerHost);
+
+    /** Override set for Host with SetHostLimit, or 0 if it uses the default. */
+    int32 GetHostLimitOverride(const FString& Host) const;
+
+    FHttpSchedulerStats GetStats() const;
+    int32 GetActiveRequestCount(const FString& Host) const;
+    int32 GetQueuedRequestCount(const FString& Host) const;
+
+private:
+    /** Pop every queued request that can start now. Caller holds Lock. */
+    void CollectStartable(TArray<TFunction<void()>>& OutStart);
+
+    /** Whether a request may start given current usage. Caller holds Lock. */
+    bool CanStart(const FMasterHttpScheduledRequest& Request) const;
+
+    /** Account for a started request. Caller holds Lock. */
+    void MarkStarted(const FMasterHttpScheduledRequest& Request);
+
+    int32 GetHostLimit(const FString& Host) const;
+
+    static constexpr int32 NumPriorities = static_cast<int32>(EHttpRequestPriority::Background) + 1;
+
+    mutable FCriticalSection Lock;
+
+    /** One FIFO per priority, indexed by EHttpRequestPriority. */
+    TArray<FMasterHttpScheduledRequest> Queues[NumPriorities];
+
+    TMap<FString, int32> ActivePerHost;
+    TMap<FString, int32> ActiveCriticalPerHost;     // Subset of ActivePerHost, for the Critical host cap
+    TMap<FString, int32> HostLimits;
+
+    int32 MaxInFlight = 32;
+    int32 MaxPerHost = 6;
+    int32 MaxBackgroundInFlight = 8;
+
+    int32 InFlight = 0;
+    int32 BackgroundInFlight = 0;
+    int32 PeakQueueDepth = 0;
+    int64 TotalStarted = 0;
+    double TotalQueueWaitSeconds = 0.0;
+    double MaxQueueWaitSeconds = 0.0;
+};
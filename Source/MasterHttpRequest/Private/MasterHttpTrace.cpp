@@ -0,0 +1,77 @@
+/*
+==========================================================================================
+File: MasterHttpTrace.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterHttpTrace.h"
+#include "MasterHttpRequestInternal.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+DEFINE_STAT(STAT_MasterHttp_Submit);
+DEFINE_STAT(STAT_MasterHttp_BuildRequest);
+DEFINE_STAT(STAT_MasterHttp_BuildHeaders);
+DEFINE_STAT(STAT_MasterHttp_SerializeBody);
+DEFINE_STAT(STAT_MasterHttp_CompressBody);
+DEFINE_STAT(STAT_MasterHttp_CacheLookup);
+DEFINE_STAT(STAT_MasterHttp_FinishAttempt);
+DEFINE_STAT(STAT_MasterHttp_DecodeResponse);
+DEFINE_STAT(STAT_MasterHttp_MakeResponse);
+DEFINE_STAT(STAT_MasterHttp_SplitHeaders);
+DEFINE_STAT(STAT_MasterHttp_DecodeJson);
+DEFINE_STAT(STAT_MasterHttp_QueryJson);
+DEFINE_STAT(STAT_MasterHttp_LogDebugInfo);
+
+UE_TRACE_CHANNEL_DEFINE(MasterHttpChannel);
+
+namespace MasterHttp
+{
+    static std::atomic<int64> NextRequestId{1};
+
+    /** Region names of open requests. Regions are matched by name, so each request's name must be unique. */
+    static FCriticalSection RegionLock;
+    static TMap<int64, FString> OpenRegions;
+    static std::atomic<int32> OpenRegionCount{0};
+}
+
+int64 MasterHttp::AllocateRequestId()
+{
+    return NextRequestId.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MasterHttp::BeginRequestRegion(int64 RequestId, EHttpMethod Method, const FString& URL)
+{
+#if UE_TRACE_ENABLED
+    if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(MasterHttpChannel))
+        return;
+
+    FString Name = FString::Printf(TEXT("HTTP #%lld %s %s"), RequestId, GetVerbString(Method), *URL);
+    TRACE_BEGIN_REGION(*Name);
+
+    FScopeLock ScopeLock(&RegionLock);
+    OpenRegions.Add(RequestId, MoveTemp(Name));
+    ++OpenRegionCount;
+#endif
+}
+
+void MasterHttp::EndRequestRegion(int64 RequestId)
+{
+#if UE_TRACE_ENABLED
+    // Most requests never opened a region; skip the lock for them
+    if (OpenRegionCount.load(std::memory_order_relaxed) == 0)
+        return;
+
+    FString Name;
+    {
+        FScopeLock ScopeLock(&RegionLock);
+        if (!OpenRegions.RemoveAndCopyValue(RequestId, Name))
+            return;
+        --OpenRegionCount;
+    }
+    TRACE_END_REGION(*Name);
+#endif
+}
@@ -0,0 +1,55 @@
+/*
+==========================================================================================
+File: MasterHttpTrace.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/**
+ * Profiling hooks for the request pipeline (internal use).
+ * - "stat MasterHttp" shows cycle counters for each stage.
+ * - The "MasterHttp" trace channel (-trace=cpu,region,masterhttp) adds the same stages as CPU scopes in Unreal Insights,
+ *   and a timing region per request, named by its request ID, from submission to completion.
+ */
+DECLARE_STATS_GROUP(TEXT("MasterHttp"), STATGROUP_MasterHttp, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Submit Request"), STAT_MasterHttp_Submit, STATGROUP_MasterHttp, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Build Request"), STAT_MasterHttp_BuildRequest, STATGROUP_MasterHttp, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Build Headers"), STAT_MasterHttp_BuildHeaders, STATGROUP_MasterHttp, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Serialize Body"), STAT_MasterHttp_SerializeBody, STATGROUP_MasterHttp, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Compress Body"), STAT_MasterHttp_CompressBody, STATGROUP_MasterHttp, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cache Lookup"), STAT_MasterHttp_CacheLookup, STATGROUP_MasterHttp, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Finish Attempt"), STAT_MasterHttp_FinishAttempt, STATGROUP_MasterHttp, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Decode Response"), STAT_MasterHttp_DecodeResponse, STATGROUP_MasterHttp, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Make Response"), STAT_MasterHttp_MakeResponse, STATGROUP_MasterHttp, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Split Response Headers"), STAT_MasterHttp_SplitHeaders, STATGROUP_MasterHttp, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Decode Json"), STAT_MasterHttp_DecodeJson, STATGROUP_MasterHttp, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Query Json"), STAT_MasterHttp_QueryJson, STATGROUP_MasterHttp, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Log Debug Info"), STAT_MasterHttp_LogDebugInfo, STATGROUP_MasterHttp, );
+
+UE_TRACE_CHANNEL_EXTERN(MasterHttpChannel);
+
+/** Stat cycle counter plus an Insights CPU scope on the MasterHttp channel, for one pipeline stage. */
+#define MASTERHTTP_SCOPE(Stage) \
+    SCOPE_CYCLE_COUNTER(STAT_MasterHttp_##Stage); \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("MasterHttp::" #Stage, MasterHttpChannel)
+
+namespace MasterHttp
+{
+    /** Next request ID; IDs are unique for the lifetime of the process. */
+    int64 AllocateRequestId();
+
+    /** Open the Insights timing region of a request. Does nothing unless the MasterHttp channel is enabled. */
+    void BeginRequestRegion(int64 RequestId, EHttpMethod Method, const FString& URL);
+
+    /** Close the region opened by BeginRequestRegion. */
+    void EndRequestRegion(int64 RequestId);
+}
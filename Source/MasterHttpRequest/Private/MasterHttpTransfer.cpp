@@ -0,0 +1,435 @@
+/*
+==========================================================================================
+File: MasterHttpTransfer.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterHttpTransfer.h"
+#include "MasterHttpClient.h"
+#include "MasterHttpRequestInternal.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Misc/Guid.h"
+#include "Async/Async.h"
+#include <atomic>
+
+namespace MasterHttp
+{
+    static FString ResolveFilePath(const FString& FilePath)
+    {
+        return FPaths::IsRelative(FilePath) ? FPaths::Combine(FPaths::ProjectDir(), FilePath) : FilePath;
+    }
+
+    /** Report a request that could not be started, on the game thread like a normal completion. */
+    static void FailTransfer(const FString& URL, const FString& ErrorMessage, TFunction<void(const FHttpResponseSimple&)> OnComplete)
+    {
+        FMasterHttpResult Result;
+        Result.FinalURL = URL;
+        Result.StartTime = FPlatformTime::Seconds();
+
+        Result.LocalError = EHttpErrorKind::FileError;
+        Result.LocalErrorMessage = ErrorMessage;
+
+        FHttpResponseSimple RespData = MakeResponse(Result, EResponseBody::None);
+        UE_LOG(LogTemp, Error, TEXT("❌ HTTP Error: %s"), *ErrorMessage);
+        AsyncTask(ENamedThreads::GameThread, [RespData = MoveTemp(RespData), OnComplete = MoveTemp(OnComplete)]() {
+            OnComplete(RespData);
+        });
+    }
+
+    /** Standard completion for uploads: convert the response, log it per the debug level and hand it to OnComplete. */
+    static FMasterHttpNativeComplete MakeTransferCompletion(const FHttpRequestDescriptor& Request, TFunction<void(const FHttpResponseSimple&)> OnComplete)
+    {
+        TSharedPtr<const FHttpRequestDescriptor, ESPMode::ThreadSafe> DebugRequest;
+        if (Request.Options.DebugLevel != EDebugLevel::None)
+        {
+            DebugRequest = MakeShared<const FHttpRequestDescriptor, ESPMode::ThreadSafe>(Request);
+        }
+
+        return [DebugRequest, BodyMode = GetResponseBodyMode(Request.Options), bSplitHeaders = Request.Options.bSplitResponseHeaders, OnComplete = MoveTemp(OnComplete)](const FMasterHttpResult& Result) {
+            FHttpResponseSimple RespData = MakeResponse(Result, BodyMode, bSplitHeaders);
+            if (DebugRequest.IsValid())
+            {
+                UMasterHttpRequestBPLibrary::LogDebugInfo(Result.FinalURL, DebugRequest->Method, DebugRequest->QueryParams, DebugRequest->CustomHeaders, DebugRequest->Body, RespData, DebugRequest->Options);
+            }
+            OnComplete(RespData);
+        };
+    }
+
+    /** Forward upload progress (bytes sent against a known total) to the game thread callback. */
+    static void BindUploadProgress(const FHttpRequestRef& HttpRequest, const FTransferProgress& OnProgress, int64 TotalBytes)
+    {
+        if (OnProgress)
+        {
+            HttpRequest->OnRequestProgress64().BindLambda([OnProgress, TotalBytes](FHttpRequestPtr InRequest, uint64 BytesSent, uint64 BytesReceived) {
+                OnProgress(static_cast<int64>(BytesSent), TotalBytes);
+            });
+        }
+    }
+
+    /**
+    * Read-only archive over a multipart body: small in-memory segments (boundaries, part headers, text values)
+    * interleaved with files that are opened and read only when the HTTP thread reaches them.
+    */
+    class FMultipartStreamArchive final : public FArchive
+    {
+    public:
+        struct FSegment
+        {
+            TArray<uint8> Bytes;
+            FString FilePath;
+            int64 Size = 0;
+        };
+
+        explicit FMultipartStreamArchive(TArray<FSegment>&& InSegments)
+            : Segments(MoveTemp(InSegments))
+        {
+            SetIsLoading(true);
+            SetIsPersistent(false);
+            for (const FSegment& Segment : Segments)
+            {
+                TotalBytes += Segment.Size;
+            }
+        }
+
+        virtual void Serialize(void* Data, int64 Num) override
+        {
+            uint8* Out = static_cast<uint8*>(Data);
+            while (Num > 0)
+            {
+                if (!Segments.IsValidIndex(SegmentIndex))
+                {
+                    SetError();
+                    return;
+                }
+
+                const FSegment& Segment = Segments[SegmentIndex];
+                const int64 Available = Segment.Size - SegmentOffset;
+                if (Available <= 0)
+                {
+                    ++SegmentIndex;
+                    SegmentOffset = 0;
+                    FileReader.Reset();
+                    continue;
+                }
+
+                const int64 Chunk = FMath::Min(Num, Available);
+                if (Segment.FilePath.IsEmpty())
+                {
+                    FMemory::Memcpy(Out, Segment.Bytes.GetData() + SegmentOffset, Chunk);
+                }
+                else
+                {
+                    if (!FileReader)
+                    {
+                        FileReader.Reset(IFileManager::Get().CreateFileReader(*Segment.FilePath));
+                        if (!FileReader)
+                        {
+                            SetError();
+                            return;
+                        }
+                        FileReader->Seek(SegmentOffset);
+                    }
+                    FileReader->Serialize(Out, Chunk);
+                    if (FileReader->IsError())
+                    {
+                        SetError();
+                        return;
+                    }
+                }
+
+                Out += Chunk;
+                Num -= Chunk;
+                SegmentOffset += Chunk;
+                Position += Chunk;
+            }
+        }
+
+        virtual void Seek(int64 InPos) override
+        {
+            // Rewinds happen on redirects and retries; locate the segment and reopen its file lazily
+            FileReader.Reset();
+            Position = FMath::Clamp<int64>(InPos, 0, TotalBytes);
+            SegmentIndex = 0;
+            SegmentOffset = Position;
+            while (Segments.IsValidIndex(SegmentIndex) && SegmentOffset >= Segments[SegmentIndex].Size)
+            {
+                SegmentOffset -= Segments[SegmentIndex].Size;
+                ++SegmentIndex;
+            }
+        }
+
+        virtual int64 Tell() override { return Position; }
+        virtual int64 TotalSize() override { return TotalBytes; }
+        virtual FString GetArchiveName() const override { return TEXT("MasterHttpMultipartBody"); }
+
+    private:
+        TArray<FSegment> Segments;
+        TUniquePtr<FArchive> FileReader;
+        int32 SegmentIndex = 0;
+        int64 SegmentOffset = 0;
+        int64 Position = 0;
+        int64 TotalBytes = 0;
+    };
+
+    /** Append UTF-8 text to the in-memory segment being built. */
+    static void AppendText(FMultipartStreamArchive::FSegment& Segment, const FString& Text)
+    {
+        FTCHARToUTF8 Utf8(*Text);
+        Segment.Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+        Segment.Size = Segment.Bytes.Num();
+    }
+
+    /**
+    * State shared between the HTTP thread (which writes chunks as they arrive) and the game thread
+    * (which reports progress and finishes the file). The writer is only opened once the status code is known.
+    */
+    struct FDownloadState
+    {
+        FString FinalPath;
+        FString PartPath;
+        int64 ResumeOffset = 0;
+
+        TWeakPtr<IHttpRequest, ESPMode::ThreadSafe> HttpRequest;
+        TUniquePtr<FArchive> Writer;
+        bool bOpened = false;
+        bool bDiscardBody = false;
+        bool bWriteFailed = false;
+
+        std::atomic<int64> BytesOnDisk{0};
+        std::atomic<int64> ExpectedTotal{0};
+
+        /** Decide whether to append, restart or discard the body based on the response status. */
+        void OpenForResponse()
+        {
+            bOpened = true;
+
+            FHttpRequestPtr Pinned = HttpRequest.Pin();
+            FHttpResponsePtr Response = Pinned.IsValid() ? Pinned->GetResponse() : nullptr;
+            const int32 StatusCode = Response.IsValid() ? Response->GetResponseCode() : 0;
+
+            if (!EHttpResponseCodes::IsOk(StatusCode))
+            {
+                // Error pages are not written into the file
+                bDiscardBody = true;
+                return;
+            }
+
+            // Only a 206 continues the partial file; a 200 means the server ignored the range and sends everything again
+            const bool bAppend = ResumeOffset > 0 && StatusCode == EHttpResponseCodes::PartialContent;
+            Writer.Reset(IFileManager::Get().CreateFileWriter(*PartPath, bAppend ? FILEWRITE_Append : FILEWRITE_None));
+            if (!Writer)
+            {
+                bWriteFailed = true;
+                return;
+            }
+
+            const int64 BaseOffset = bAppend ? ResumeOffset : 0;
+            const int64 BodyLength = FCString::Atoi64(*Response->GetHeader(TEXT("Content-Length")));
+            BytesOnDisk = BaseOffset;
+            ExpectedTotal = BodyLength > 0 ? BaseOffset + BodyLength : 0;
+        }
+
+        /** Write one chunk. Setting Length to 0 tells the engine to abort the request. */
+        void ReceiveChunk(void* Ptr, int64& Length)
+        {
+            if (!bOpened)
+            {
+                OpenForResponse();
+            }
+
+            if (bDiscardBody)
+                return;
+
+            if (!Writer)
+            {
+                Length = 0;
+                return;
+            }
+
+            Writer->Serialize(Ptr, Length);
+            if (Writer->IsError())
+            {
+                bWriteFailed = true;
+                Length = 0;
+                return;
+            }
+            BytesOnDisk += Length;
+        }
+    };
+}
+
+FHttpRequestHandle MasterHttp::DownloadToFile(UMasterHttpClient* Client, FHttpRequestDescriptor Request, const FString& FilePath, bool bResume, FTransferProgress OnProgress, TFunction<void(const FHttpResponseSimple&)> OnComplete)
+{
+    TSharedRef<FDownloadState, ESPMode::ThreadSafe> State = MakeShared<FDownloadState, ESPMode::ThreadSafe>();
+    State->FinalPath = ResolveFilePath(FilePath);
+    State->PartPath = State->FinalPath + TEXT(".part");
+    IFileManager::Get().MakeDirectory(*FPaths::GetPath(State->FinalPath), true);
+
+    if (bResume)
+    {
+        State->ResumeOffset = FMath::Max<int64>(IFileManager::Get().FileSize(*State->PartPath), 0);
+    }
+    else
+    {
+        IFileManager::Get().Delete(*State->PartPath, false, true, true);
+    }
+
+    // The body goes to disk rather than into the response, so there is nothing the response cache could keep
+    Request.Options.CachePolicy = EHttpCachePolicy::None;
+
+    // Byte ranges must refer to the file itself, not to a compressed encoding of it
+    Request.Options.bDecompressResponses = false;
+
+    // Files are rarely JSON; the caller's own headers still override this
+    Request.CustomHeaders.Insert(UMasterHttpRequestBPLibrary::MakeKeyValue(TEXT("Accept"), TEXT("*/*")), 0);
+    if (State->ResumeOffset > 0)
+    {
+        Request.CustomHeaders.Add(UMasterHttpRequestBPLibrary::MakeKeyValue(TEXT("Range"), FString::Printf(TEXT("bytes=%lld-"), State->ResumeOffset)));
+    }
+
+    TSharedPtr<const FHttpRequestDescriptor, ESPMode::ThreadSafe> DebugRequest;
+    if (Request.Options.DebugLevel != EDebugLevel::None)
+    {
+        DebugRequest = MakeShared<const FHttpRequestDescriptor, ESPMode::ThreadSafe>(Request);
+    }
+
+    FMasterHttpConfigureRequest Configure = [State, OnProgress](const FHttpRequestRef& HttpRequest) {
+        State->HttpRequest = HttpRequest;
+        HttpRequest->SetResponseBodyReceiveStreamDelegateV2(FHttpRequestStreamDelegateV2::CreateLambda([State](void* Ptr, int64& Length) {
+            State->ReceiveChunk(Ptr, Length);
+        }));
+
+        if (OnProgress)
+        {
+            HttpRequest->OnRequestProgress64().BindLambda([State, OnProgress](FHttpRequestPtr InRequest, uint64 BytesSent, uint64 BytesReceived) {
+                OnProgress(State->BytesOnDisk.load(), State->ExpectedTotal.load());
+            });
+        }
+    };
+
+    FMasterHttpNativeComplete Complete = [State, bResume, DebugRequest, OnComplete = MoveTemp(OnComplete)](const FMasterHttpResult& Result) {
+        FHttpResponseSimple RespData = MakeResponse(Result, EResponseBody::None);
+
+        // A successful response with an empty body never reached the stream delegate
+        if (RespData.bSuccess && !State->bOpened)
+        {
+            State->OpenForResponse();
+        }
+        State->Writer.Reset();
+
+        if (RespData.bSuccess && State->bWriteFailed)
+        {
+            RespData.bSuccess = false;
+            RespData.ErrorMessage = FString::Printf(TEXT("Failed to write %s"), *State->PartPath);
+            RespData.ErrorKind = EHttpErrorKind::FileError;
+        }
+        else if (RespData.bSuccess && !IFileManager::Get().Move(*State->FinalPath, *State->PartPath, true, true))
+        {
+            RespData.bSuccess = false;
+            RespData.ErrorMessage = FString::Printf(TEXT("Failed to move download to %s"), *State->FinalPath);
+            RespData.ErrorKind = EHttpErrorKind::FileError;
+        }
+
+        if (RespData.bSuccess)
+        {
+            RespData.ContentLength = static_cast<int32>(FMath::Min<int64>(IFileManager::Get().FileSize(*State->FinalPath), MAX_int32));
+        }
+        else if (!bResume || (Result.Response.IsValid() && Result.Response->GetResponseCode() == 416))
+        {
+            // Keep the partial file only when a later call may resume it (416: the stored range is no longer valid)
+            IFileManager::Get().Delete(*State->PartPath, false, true, true);
+        }
+
+        if (DebugRequest.IsValid())
+        {
+            UMasterHttpRequestBPLibrary::LogDebugInfo(Result.FinalURL, DebugRequest->Method, DebugRequest->QueryParams, DebugRequest->CustomHeaders, DebugRequest->Body, RespData, DebugRequest->Options);
+        }
+
+        OnComplete(RespData);
+    };
+
+    return Client->ProcessRequest(MoveTemp(Request), false, MoveTemp(Complete), MoveTemp(Configure));
+}
+
+FHttpRequestHandle MasterHttp::UploadFile(UMasterHttpClient* Client, FHttpRequestDescriptor Request, const FString& FilePath, FTransferProgress OnProgress, TFunction<void(const FHttpResponseSimple&)> OnComplete)
+{
+    const FString FullPath = ResolveFilePath(FilePath);
+    const int64 FileSize = IFileManager::Get().FileSize(*FullPath);
+    if (FileSize < 0)
+    {
+        FailTransfer(Request.URL, FString::Printf(TEXT("File not found: %s"), *FullPath), MoveTemp(OnComplete));
+        return FHttpRequestHandle();
+    }
+
+    FMasterHttpNativeComplete Complete = MakeTransferCompletion(Request, MoveTemp(OnComplete));
+    FMasterHttpConfigureRequest Configure = [FullPath, FileSize, OnProgress = MoveTemp(OnProgress)](const FHttpRequestRef& HttpRequest) {
+        // Replaces the (empty) body set by BuildRequest; the engine reads the file in chunks while sending
+        HttpRequest->SetContentAsStreamedFile(FullPath);
+        BindUploadProgress(HttpRequest, OnProgress, FileSize);
+    };
+
+    return Client->ProcessRequest(MoveTemp(Request), false, MoveTemp(Complete), MoveTemp(Configure));
+}
+
+FHttpRequestHandle MasterHttp::SendMultipart(UMasterHttpClient* Client, FHttpRequestDescriptor Request, const TArray<FHttpMultipartPart>& Parts, FTransferProgress OnProgress, TFunction<void(const FHttpResponseSimple&)> OnComplete)
+{
+    const FString Boundary = TEXT("----MasterHttpBoundary") + FGuid::NewGuid().ToString(EGuidFormats::Digits);
+
+    // Consecutive text is merged into one memory segment; each file becomes its own streamed segment
+    TArray<FMultipartStreamArchive::FSegment> Segments;
+    FMultipartStreamArchive::FSegment Pending;
+    for (const FHttpMultipartPart& Part : Parts)
+    {
+        const bool bIsFile = !Part.FilePath.IsEmpty();
+        FString PartHeader = FString::Printf(TEXT("--%s\r\nContent-Disposition: form-data; name=\"%s\""), *Boundary, *Part.Name);
+
+        if (!bIsFile)
+        {
+            if (!Part.ContentType.IsEmpty())
+            {
+                PartHeader += FString::Printf(TEXT("\r\nContent-Type: %s"), *Part.ContentType);
+            }
+            AppendText(Pending, PartHeader + TEXT("\r\n\r\n") + Part.Value + TEXT("\r\n"));
+            continue;
+        }
+
+        FMultipartStreamArchive::FSegment File;
+        File.FilePath = ResolveFilePath(Part.FilePath);
+        File.Size = IFileManager::Get().FileSize(*File.FilePath);
+        if (File.Size < 0)
+        {
+            FailTransfer(Request.URL, FString::Printf(TEXT("File not found: %s"), *File.FilePath), MoveTemp(OnComplete));
+            return FHttpRequestHandle();
+        }
+
+        const FString FileName = Part.FileName.IsEmpty() ? FPaths::GetCleanFilename(File.FilePath) : Part.FileName;
+        const FString FileContentType = Part.ContentType.IsEmpty() ? TEXT("application/octet-stream") : Part.ContentType;
+        AppendText(Pending, PartHeader + FString::Printf(TEXT("; filename=\"%s\"\r\nContent-Type: %s\r\n\r\n"), *FileName, *FileContentType));
+
+        Segments.Add(MoveTemp(Pending));
+        Pending = FMultipartStreamArchive::FSegment();
+        Segments.Add(MoveTemp(File));
+        AppendText(Pending, TEXT("\r\n"));
+    }
+    AppendText(Pending, FString::Printf(TEXT("--%s--\r\n"), *Boundary));
+    Segments.Add(MoveTemp(Pending));
+
+    TSharedRef<FMultipartStreamArchive, ESPMode::ThreadSafe> Body = MakeShared<FMultipartStreamArchive, ESPMode::ThreadSafe>(MoveTemp(Segments));
+    const int64 TotalBytes = Body->TotalSize();
+
+    // Added last so it overrides the content type from the options and any default header
+    Request.CustomHeaders.Add(UMasterHttpRequestBPLibrary::MakeKeyValue(TEXT("Content-Type"), TEXT("multipart/form-data; boundary=") + Boundary));
+    Request.Body.Reset();
+    Request.BinaryBody.Reset();
+
+    FMasterHttpNativeComplete Complete = MakeTransferCompletion(Request, MoveTemp(OnComplete));
+    FMasterHttpConfigureRequest Configure = [Body, TotalBytes, OnProgress = MoveTemp(OnProgress)](const FHttpRequestRef& HttpRequest) {
+        HttpRequest->SetContentFromStream(Body);
+        BindUploadProgress(HttpRequest, OnProgress, TotalBytes);
+    };
+
+    return Client->ProcessRequest(MoveTemp(Request), false, MoveTemp(Complete), MoveTemp(Configure));
+}
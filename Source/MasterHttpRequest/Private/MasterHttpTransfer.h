@@ -0,0 +1,33 @@
+/*
+==========================================================================================
+File: MasterHttpTransfer.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MasterHttpRequestBPLibrary.h"
+
+class UMasterHttpClient;
+
+/** Large transfers that stream to and from disk instead of going through FString / TArray bodies (internal use). */
+namespace MasterHttp
+{
+    /** Progress of a transfer: bytes moved so far and the expected total (0 if unknown). */
+    using FTransferProgress = TFunction<void(int64 BytesTransferred, int64 TotalBytes)>;
+
+    /**
+    * Stream a response body into FilePath through "<FilePath>.part", optionally resuming a previous partial download.
+    * OnProgress and OnComplete are called on the game thread. Like the other transfers, returns an invalid handle if it could not start.
+    */
+    FHttpRequestHandle DownloadToFile(UMasterHttpClient* Client, FHttpRequestDescriptor Request, const FString& FilePath, bool bResume, FTransferProgress OnProgress, TFunction<void(const FHttpResponseSimple&)> OnComplete);
+
+    /** Send a file as the request body, streamed from disk. OnProgress and OnComplete are called on the game thread. */
+    FHttpRequestHandle UploadFile(UMasterHttpClient* Client, FHttpRequestDescriptor Request, const FString& FilePath, FTransferProgress OnProgress, TFunction<void(const FHttpResponseSimple&)> OnComplete);
+
+    /** Send a multipart/form-data body whose file parts are streamed from disk. OnProgress and OnComplete are called on the game thread. */
+    FHttpRequestHandle SendMultipart(UMasterHttpClient* Client, FHttpRequestDescriptor Request, const TArray<FHttpMultipartPart>& Parts, FTransferProgress OnProgress, TFunction<void(const FHttpResponseSimple&)> OnComplete);
+}
@@ -0,0 +1,254 @@
+/*
+==========================================================================================
+File: MasterJsonDocument.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterJsonDocument.h"
+#include "MasterJsonPath.h"
+#include "MasterHttpTrace.h"
+#include "Json.h"
+#include "UObject/Package.h"
+
+UMasterJsonDocument* UMasterJsonDocument::ParseJsonString(const FString& JsonString, bool& bSuccess)
+{
+    TSharedPtr<FJsonValue> Root;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+    bSuccess = FJsonSerializer::Deserialize(Reader, Root) && Root.IsValid();
+    return bSuccess ? FromJsonValue(Root) : nullptr;
+}
+
+UMasterJsonDocument* UMasterJsonDocument::ParseJsonBytes(const TArray<uint8>& Bytes, bool& bSuccess)
+{
+    // Read the UTF-8 payload in place instead of widening it to an FString first
+    TSharedPtr<FJsonValue> Root;
+    FUtf8StringView JsonView(reinterpret_cast<const UTF8CHAR*>(Bytes.GetData()), Bytes.Num());
+    TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(JsonView);
+    bSuccess = FJsonSerializer::Deserialize(Reader, Root) && Root.IsValid();
+    return bSuccess ? FromJsonValue(Root) : nullptr;
+}
+
+UMasterJsonDocument* UMasterJsonDocument::ParseJsonResponse(const FHttpResponseSimple& Response, bool& bSuccess)
+{
+    // Raw responses are parsed straight from their bytes
+    if (Response.Data.IsEmpty() && Response.Content.Num() > 0)
+        return ParseJsonBytes(Response.Content, bSuccess);
+
+    return ParseJsonString(Response.Data, bSuccess);
+}
+
+UMasterJsonDocument* UMasterJsonDocument::FromJsonValue(const TSharedPtr<FJsonValue>& RootValue, UObject* Outer)
+{
+    if (!RootValue.IsValid())
+        return nullptr;
+
+    UMasterJsonDocument* Document = NewObject<UMasterJsonDocument>(Outer ? Outer : GetTransientPackage());
+    Document->RootValue = RootValue;
+    return Document;
+}
+
+TSharedPtr<FJsonValue> UMasterJsonDocument::FindValue(const FString& KeyPath)
+{
+    if (KeyPath.IsEmpty() || KeyPath == TEXT("$"))
+        return RootValue;
+
+    if (const TSharedPtr<FJsonValue>* Cached = PathCache.Find(KeyPath))
+        return *Cached;
+
+    // Resolve the parent through the cache so "a.b.c" and "a.b.d" (or "items[0]" and "items[1]") only walk the parent once
+    int32 DotIndex = INDEX_NONE;
+    int32 BracketIndex = INDEX_NONE;
+    KeyPath.FindLastChar(TEXT('.'), DotIndex);
+    KeyPath.FindLastChar(TEXT('['), BracketIndex);
+    const int32 SplitIndex = FMath::Max(DotIndex, BracketIndex);
+
+    TSharedPtr<FJsonValue> Parent = SplitIndex > 0 ? FindValue(KeyPath.Left(SplitIndex)) : RootValue;
+
+    TSharedPtr<FJsonValue> Found;
+    TArray<MasterHttp::FJsonPathSegment> Segments;
+    if (MasterHttp::ParseJsonPath(SplitIndex > 0 ? KeyPath.Mid(SplitIndex) : KeyPath, Segments))
+    {
+        // A trailing "." leaves no segment, like "a." resolving to "a"
+        Found = Parent;
+        for (const MasterHttp::FJsonPathSegment& Segment : Segments)
+        {
+            Found = MasterHttp::ResolveJsonSegment(Found, Segment);
+        }
+    }
+
+    PathCache.Add(KeyPath, Found);
+    return Found;
+}
+
+bool UMasterJsonDocument::HasField(const FString& KeyPath)
+{
+    return FindValue(KeyPath).IsValid();
+}
+
+bool UMasterJsonDocument::GetString(const FString& KeyPath, FString& Value)
+{
+    Value = TEXT("");
+    TSharedPtr<FJsonValue> Found = FindValue(KeyPath);
+    if (!Found.IsValid())
+        return false;
+
+    switch (Found->Type)
+    {
+        case EJson::String:
+        case EJson::Number:
+        case EJson::Boolean:
+            Value = JsonValueToString(Found);
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool UMasterJsonDocument::GetNumber(const FString& KeyPath, double& Value)
+{
+    Value = 0.0;
+    TSharedPtr<FJsonValue> Found = FindValue(KeyPath);
+    return Found.IsValid() && Found->TryGetNumber(Value);
+}
+
+bool UMasterJsonDocument::GetBool(const FString& KeyPath, bool& Value)
+{
+    Value = false;
+    TSharedPtr<FJsonValue> Found = FindValue(KeyPath);
+    return Found.IsValid() && Found->TryGetBool(Value);
+}
+
+UMasterJsonDocument* UMasterJsonDocument::GetObject(const FString& KeyPath, bool& bSuccess)
+{
+    TSharedPtr<FJsonValue> Found = FindValue(KeyPath);
+    bSuccess = Found.IsValid() && Found->Type == EJson::Object;
+    return bSuccess ? FromJsonValue(Found, this) : nullptr;
+}
+
+bool UMasterJsonDocument::GetObjectFields(const FString& KeyPath, TArray<FHttpKeyValue>& ObjectFields)
+{
+    ObjectFields.Empty();
+    TSharedPtr<FJsonValue> Found = FindValue(KeyPath);
+    if (!Found.IsValid() || Found->Type != EJson::Object)
+        return false;
+
+    const TSharedPtr<FJsonObject>& Obj = Found->AsObject();
+    ObjectFields.Reserve(Obj->Values.Num());
+    for (const auto& Pair : Obj->Values)
+    {
+        ObjectFields.Add(UMasterHttpRequestBPLibrary::MakeKeyValue(Pair.Key, JsonValueToString(Pair.Value)));
+    }
+    return true;
+}
+
+bool UMasterJsonDocument::GetArray(const FString& KeyPath, TArray<FString>& ArrayValues)
+{
+    ArrayValues.Empty();
+    TSharedPtr<FJsonValue> Found = FindValue(KeyPath);
+    if (!Found.IsValid() || Found->Type != EJson::Array)
+        return false;
+
+    const TArray<TSharedPtr<FJsonValue>>& Arr = Found->AsArray();
+    ArrayValues.Reserve(Arr.Num());
+    for (const auto& Elem : Arr)
+    {
+        ArrayValues.Add(JsonValueToString(Elem));
+    }
+    return true;
+}
+
+bool UMasterJsonDocument::Query(const TArray<FString>& Paths, TArray<FJsonQueryResult>& Results)
+{
+    MASTERHTTP_SCOPE(QueryJson);
+
+    const MasterHttp::FJsonPathQuery PathQuery(Paths);
+
+    Results.Reset(Paths.Num());
+    for (int32 PathIndex = 0; PathIndex < Paths.Num(); ++PathIndex)
+    {
+        FJsonQueryResult& Result = Results.AddDefaulted_GetRef();
+        Result.Path = Paths[PathIndex];
+        Result.bValidPath = PathQuery.IsValidPath(PathIndex);
+    }
+
+    PathQuery.Evaluate(RootValue, [this, &Results](int32 PathIndex, const TSharedPtr<FJsonValue>& Value)
+    {
+        FJsonQueryResult& Result = Results[PathIndex];
+        ++Result.MatchCount;
+        switch (Value->Type)
+        {
+            case EJson::String:
+                Result.Strings.Add(Value->AsString());
+                break;
+            case EJson::Number:
+                Result.Numbers.Add(Value->AsNumber());
+                break;
+            case EJson::Boolean:
+                Result.Bools.Add(Value->AsBool());
+                break;
+            case EJson::Object:
+            case EJson::Array:
+                Result.Documents.Add(FromJsonValue(Value, this));
+                break;
+            default:
+                break;
+        }
+    });
+
+    return PathQuery.AreAllPathsValid();
+}
+
+bool UMasterJsonDocument::QueryJsonString(const FString& JsonString, const TArray<FString>& Paths, TArray<FJsonQueryResult>& Results)
+{
+    bool bParsed = false;
+    UMasterJsonDocument* Document = ParseJsonString(JsonString, bParsed);
+    if (!Document)
+    {
+        Results.Reset(Paths.Num());
+        for (const FString& Path : Paths)
+        {
+            Results.AddDefaulted_GetRef().Path = Path;
+        }
+        return false;
+    }
+    return Document->Query(Paths, Results);
+}
+
+FString UMasterJsonDocument::ToJsonString(const FString& KeyPath)
+{
+    return JsonValueToString(FindValue(KeyPath));
+}
+
+FString UMasterJsonDocument::JsonValueToString(const TSharedPtr<FJsonValue>& JsonValue)
+{
+    if (!JsonValue.IsValid())
+        return TEXT("");
+
+    switch (JsonValue->Type)
+    {
+        case EJson::String:
+            return JsonValue->AsString();
+        case EJson::Number:
+            return FString::SanitizeFloat(JsonValue->AsNumber());
+        case EJson::Boolean:
+            return JsonValue->AsBool() ? TEXT("true") : TEXT("false");
+        case EJson::Object:
+        {
+            FString ObjectJson;
+            TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ObjectJson);
+            FJsonSerializer::Serialize(JsonValue->AsObject().ToSharedRef(), Writer);
+            return ObjectJson;
+        }
+        case EJson::Array:
+        {
+            FString ArrayJson;
+            TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ArrayJson);
+            FJsonSerializer::Serialize(JsonValue->AsArray(), Writer);
+            return ArrayJson;
+        }
+        default:
+            return TEXT("");
+    }
+}
@@ -0,0 +1,219 @@
+/*
+==========================================================================================
+File: MasterJsonPath.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "MasterJsonPath.h"
+#include "Dom/JsonObject.h"
+
+namespace MasterHttp
+{
+    bool ParseJsonPath(const FString& Path, TArray<FJsonPathSegment>& OutSegments)
+    {
+        OutSegments.Reset();
+
+        const int32 Len = Path.Len();
+        int32 i = 0;
+
+        // "$", "$.a" and "$[0]" start at the root; a key that merely begins with '$' is kept
+        if (Len > 0 && Path[0] == TEXT('$') && (Len == 1 || Path[1] == TEXT('.') || Path[1] == TEXT('[')))
+            i = 1;
+
+        while (i < Len)
+        {
+            const TCHAR C = Path[i];
+            if (C == TEXT('.'))
+            {
+                ++i;
+                continue;
+            }
+
+            if (C == TEXT('['))
+            {
+                int32 Close = i + 1;
+                while (Close < Len && Path[Close] != TEXT(']'))
+                    ++Close;
+                if (Close >= Len)
+                    return false;
+
+                const FString Inner = Path.Mid(i + 1, Close - i - 1).TrimStartAndEnd();
+                FJsonPathSegment& Segment = OutSegments.AddDefaulted_GetRef();
+                if (Inner == TEXT("*"))
+                {
+                    Segment.Kind = FJsonPathSegment::EKind::Wildcard;
+                }
+                else
+                {
+                    const int32 DigitsStart = Inner.StartsWith(TEXT("-")) ? 1 : 0;
+                    if (Inner.Len() <= DigitsStart)
+                        return false;
+                    for (int32 Digit = DigitsStart; Digit < Inner.Len(); ++Digit)
+                    {
+                        if (!FChar::IsDigit(Inner[Digit]))
+                            return false;
+                    }
+                    Segment.Kind = FJsonPathSegment::EKind::Index;
+                    Segment.Index = FCString::Atoi(*Inner);
+                }
+                i = Close + 1;
+                continue;
+            }
+
+            int32 End = i;
+            while (End < Len && Path[End] != TEXT('.') && Path[End] != TEXT('['))
+                ++End;
+
+            FJsonPathSegment& Segment = OutSegments.AddDefaulted_GetRef();
+            Segment.Key = Path.Mid(i, End - i);
+            if (Segment.Key == TEXT("*"))
+            {
+                Segment.Kind = FJsonPathSegment::EKind::Wildcard;
+                Segment.Key.Reset();
+            }
+            i = End;
+        }
+        return true;
+    }
+
+    TSharedPtr<FJsonValue> ResolveJsonSegment(const TSharedPtr<FJsonValue>& Parent, const FJsonPathSegment& Segment)
+    {
+        if (!Parent.IsValid())
+            return nullptr;
+
+        switch (Segment.Kind)
+        {
+            case FJsonPathSegment::EKind::Key:
+                return Parent->Type == EJson::Object ? Parent->AsObject()->TryGetField(Segment.Key) : nullptr;
+            case FJsonPathSegment::EKind::Index:
+            {
+                if (Parent->Type != EJson::Array)
+                    return nullptr;
+                const TArray<TSharedPtr<FJsonValue>>& Arr = Parent->AsArray();
+                const int32 Index = Segment.Index < 0 ? Arr.Num() + Segment.Index : Segment.Index;
+                return Arr.IsValidIndex(Index) ? Arr[Index] : nullptr;
+            }
+            default:
+                return nullptr;
+        }
+    }
+
+    FJsonPathQuery::FJsonPathQuery(const TArray<FString>& Paths)
+    {
+        Nodes.AddDefaulted();
+        ValidPaths.Init(false, Paths.Num());
+
+        TArray<FJsonPathSegment> Segments;
+        for (int32 PathIndex = 0; PathIndex < Paths.Num(); ++PathIndex)
+        {
+            if (!ParseJsonPath(Paths[PathIndex], Segments))
+                continue;
+
+            int32 NodeIndex = 0;
+            for (const FJsonPathSegment& Segment : Segments)
+            {
+                NodeIndex = FindOrAddChild(NodeIndex, Segment);
+            }
+            Nodes[NodeIndex].Terminals.Add(PathIndex);
+            ValidPaths[PathIndex] = true;
+        }
+    }
+
+    int32 FJsonPathQuery::FindOrAddChild(int32 NodeIndex, const FJsonPathSegment& Segment)
+    {
+        // Look up first: adding a node may reallocate Nodes
+        switch (Segment.Kind)
+        {
+            case FJsonPathSegment::EKind::Key:
+                for (const TPair<FString, int32>& Child : Nodes[NodeIndex].KeyChildren)
+                {
+                    if (Child.Key.Equals(Segment.Key, ESearchCase::CaseSensitive))
+                        return Child.Value;
+                }
+                break;
+            case FJsonPathSegment::EKind::Index:
+                for (const TPair<int32, int32>& Child : Nodes[NodeIndex].IndexChildren)
+                {
+                    if (Child.Key == Segment.Index)
+                        return Child.Value;
+                }
+                break;
+            case FJsonPathSegment::EKind::Wildcard:
+                if (Nodes[NodeIndex].WildcardChild != INDEX_NONE)
+                    return Nodes[NodeIndex].WildcardChild;
+                break;
+        }
+
+        const int32 ChildIndex = Nodes.AddDefaulted();
+        FNode& Parent = Nodes[NodeIndex];
+        switch (Segment.Kind)
+        {
+            case FJsonPathSegment::EKind::Key:
+                Parent.KeyChildren.Emplace(Segment.Key, ChildIndex);
+                break;
+            case FJsonPathSegment::EKind::Index:
+                Parent.IndexChildren.Emplace(Segment.Index, ChildIndex);
+                break;
+            case FJsonPathSegment::EKind::Wildcard:
+                Parent.WildcardChild = ChildIndex;
+                break;
+        }
+        return ChildIndex;
+    }
+
+    void FJsonPathQuery::Evaluate(const TSharedPtr<FJsonValue>& Root, TFunctionRef<void(int32 PathIndex, const TSharedPtr<FJsonValue>& Value)> OnMatch) const
+    {
+        if (Root.IsValid())
+            Visit(0, Root, OnMatch);
+    }
+
+    void FJsonPathQuery::Visit(int32 NodeIndex, const TSharedPtr<FJsonValue>& Value, TFunctionRef<void(int32, const TSharedPtr<FJsonValue>&)> OnMatch) const
+    {
+        const FNode& Node = Nodes[NodeIndex];
+        for (int32 PathIndex : Node.Terminals)
+        {
+            OnMatch(PathIndex, Value);
+        }
+
+        if (Value->Type == EJson::Object)
+        {
+            const TSharedPtr<FJsonObject>& Obj = Value->AsObject();
+            for (const TPair<FString, int32>& Child : Node.KeyChildren)
+            {
+                if (const TSharedPtr<FJsonValue>* Field = Obj->Values.Find(Child.Key))
+                {
+                    if (Field->IsValid())
+                        Visit(Child.Value, *Field, OnMatch);
+                }
+            }
+            if (Node.WildcardChild != INDEX_NONE)
+            {
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Obj->Values)
+                {
+                    if (Field.Value.IsValid())
+                        Visit(Node.WildcardChild, Field.Value, OnMatch);
+                }
+            }
+        }
+        else if (Value->Type == EJson::Array)
+        {
+            const TArray<TSharedPtr<FJsonValue>>& Arr = Value->AsArray();
+            for (const TPair<int32, int32>& Child : Node.IndexChildren)
+            {
+                const int32 Index = Child.Key < 0 ? Arr.Num() + Child.Key : Child.Key;
+                if (Arr.IsValidIndex(Index) && Arr[Index].IsValid())
+                    Visit(Child.Value, Arr[Index], OnMatch);
+            }
+            if (Node.WildcardChild != INDEX_NONE)
+            {
+                for (const TSharedPtr<FJsonValue>& Elem : Arr)
+                {
+                    if (Elem.IsValid())
+                        Visit(Node.WildcardChild, Elem, OnMatch);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,74 @@
+/*
+==========================================================================================
+File: MasterJsonPath.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+
+/**
+ * Key paths with array indexing and wildcards (internal use).
+ * Syntax: "data.user.email", "items[3].id", "items[-1]", "items[*].price", "stats.*.value", with an optional leading "$".
+ */
+namespace MasterHttp
+{
+    struct FJsonPathSegment
+    {
+        enum class EKind : uint8
+        {
+            Key,
+            Index,      // Negative indices count from the end of the array
+            Wildcard    // Every element of an array or every field of an object
+        };
+
+        EKind Kind = EKind::Key;
+        FString Key;
+        int32 Index = 0;
+    };
+
+    /**
+    * Split a path into segments. Empty keys are skipped, as DecodeJson always did ("a..b" is "a.b").
+    * Returns false on malformed brackets ("items[x]", "items[2").
+    */
+    bool ParseJsonPath(const FString& Path, TArray<FJsonPathSegment>& OutSegments);
+
+    /** Step from Parent through one key or index segment. Wildcards never resolve to a single value. */
+    TSharedPtr<FJsonValue> ResolveJsonSegment(const TSharedPtr<FJsonValue>& Parent, const FJsonPathSegment& Segment);
+
+    /**
+    * A set of paths compiled into a prefix tree, so all of them are evaluated in one walk of a document.
+    * Shared prefixes ("items[*].id" and "items[*].price") are visited once, and only the branches named by a path are walked.
+    */
+    class FJsonPathQuery
+    {
+    public:
+        explicit FJsonPathQuery(const TArray<FString>& Paths);
+
+        /** False if the path at PathIndex could not be parsed; it never matches. */
+        bool IsValidPath(int32 PathIndex) const { return ValidPaths.IsValidIndex(PathIndex) && ValidPaths[PathIndex]; }
+        bool AreAllPathsValid() const { return ValidPaths.Find(false) == INDEX_NONE; }
+
+        /** Walk Root once and report every match, in document order for each path. */
+        void Evaluate(const TSharedPtr<FJsonValue>& Root, TFunctionRef<void(int32 PathIndex, const TSharedPtr<FJsonValue>& Value)> OnMatch) const;
+
+    private:
+        struct FNode
+        {
+            TArray<int32> Terminals;                    // Paths ending at this node
+            TArray<TPair<FString, int32>> KeyChildren;
+            TArray<TPair<int32, int32>> IndexChildren;
+            int32 WildcardChild = INDEX_NONE;
+        };
+
+        int32 FindOrAddChild(int32 NodeIndex, const FJsonPathSegment& Segment);
+        void Visit(int32 NodeIndex, const TSharedPtr<FJsonValue>& Value, TFunctionRef<void(int32, const TSharedPtr<FJsonValue>&)> OnMatch) const;
+
+        TArray<FNode> Nodes;
+        TBitArray<> ValidPaths;
+    };
+}
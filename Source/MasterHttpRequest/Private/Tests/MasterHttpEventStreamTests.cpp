@@ -0,0 +1,233 @@
+/*
+==========================================================================================
+File: MasterHttpEventStreamTests.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "MasterHttpEventStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MasterHttpEventStreamTests
+{
+    struct FParsedStream
+    {
+        TArray<FHttpServerEvent> Events;
+        FString LastEventId;
+        int32 RetryMilliseconds = -1;
+        bool bWithinLineLimit = true;
+    };
+
+    static void AppendText(TArray<uint8>& Bytes, const FString& Text)
+    {
+        const FTCHARToUTF8 Utf8(*Text);
+        Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+    }
+
+    static TArray<uint8> ToBytes(const FString& Text)
+    {
+        TArray<uint8> Bytes;
+        AppendText(Bytes, Text);
+        return Bytes;
+    }
+
+    /** Feed Bytes to Parser, cutting them at each offset in Cuts (ascending). Stops where the stream would be dropped. */
+    static void FeedInPieces(MasterHttp::FServerEventParser& Parser, const TArray<uint8>& Bytes, const TArray<int32>& Cuts, FParsedStream& Out)
+    {
+        int32 Start = 0;
+        for (int32 Piece = 0; Piece <= Cuts.Num(); ++Piece)
+        {
+            const int32 End = Piece < Cuts.Num() ? Cuts[Piece] : Bytes.Num();
+            Out.bWithinLineLimit &= Parser.Feed(Bytes.GetData() + Start, End - Start, [&Out](FHttpServerEvent&& Event) {
+                Out.Events.Add(MoveTemp(Event));
+            });
+            if (!Out.bWithinLineLimit)
+                break;
+            Start = End;
+        }
+        Out.LastEventId = Parser.LastEventId;
+        Out.RetryMilliseconds = Parser.RetryMilliseconds;
+    }
+
+    static FParsedStream Parse(const TArray<uint8>& Bytes, const TArray<int32>& Cuts, int32 MaxLineBytes)
+    {
+        MasterHttp::FServerEventParser Parser(MaxLineBytes);
+        FParsedStream Out;
+        FeedInPieces(Parser, Bytes, Cuts, Out);
+        return Out;
+    }
+
+    static bool IsSameStream(const FParsedStream& A, const FParsedStream& B)
+    {
+        if (A.Events.Num() != B.Events.Num() || A.LastEventId != B.LastEventId || A.RetryMilliseconds != B.RetryMilliseconds || A.bWithinLineLimit != B.bWithinLineLimit)
+            return false;
+        for (int32 i = 0; i < A.Events.Num(); ++i)
+        {
+            if (A.Events[i].Event != B.Events[i].Event || A.Events[i].Data != B.Events[i].Data || A.Events[i].Id != B.Events[i].Id)
+                return false;
+        }
+        return true;
+    }
+
+    /**
+    * Parse Bytes in one piece, then cut at every offset and byte by byte, reporting any split that changes the result.
+    * Returns the one-piece result.
+    */
+    static FParsedStream ParseEverySplit(FAutomationTestBase& Test, const FString& What, const TArray<uint8>& Bytes, int32 MaxLineBytes = 1024)
+    {
+        const FParsedStream Whole = Parse(Bytes, {}, MaxLineBytes);
+
+        for (int32 Cut = 1; Cut < Bytes.Num(); ++Cut)
+        {
+            if (!IsSameStream(Whole, Parse(Bytes, { Cut }, MaxLineBytes)))
+            {
+                Test.AddError(FString::Printf(TEXT("%s: splitting at byte %d changes the result"), *What, Cut));
+            }
+        }
+
+        TArray<int32> EveryByte;
+        for (int32 Cut = 1; Cut < Bytes.Num(); ++Cut)
+        {
+            EveryByte.Add(Cut);
+        }
+        if (!IsSameStream(Whole, Parse(Bytes, EveryByte, MaxLineBytes)))
+        {
+            Test.AddError(FString::Printf(TEXT("%s: feeding one byte at a time changes the result"), *What));
+        }
+        return Whole;
+    }
+
+    static void TestEvent(FAutomationTestBase& Test, const FString& What, const FParsedStream& Stream, int32 EventIndex, const FString& Event, const FString& Data, const FString& Id)
+    {
+        if (!Stream.Events.IsValidIndex(EventIndex))
+        {
+            Test.AddError(FString::Printf(TEXT("%s: event %d was not dispatched"), *What, EventIndex));
+            return;
+        }
+        Test.TestEqual(What + TEXT(" event"), Stream.Events[EventIndex].Event, Event);
+        Test.TestEqual(What + TEXT(" data"), Stream.Events[EventIndex].Data, Data);
+        Test.TestEqual(What + TEXT(" id"), Stream.Events[EventIndex].Id, Id);
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMasterHttpEventStreamParserTest, "MasterHttp.EventStream.Parser", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMasterHttpEventStreamParserTest::RunTest(const FString& Parameters)
+{
+    using namespace MasterHttpEventStreamTests;
+
+    // Fields, multi-line data, comments and the one optional space after the colon
+    {
+        const FParsedStream Stream = ParseEverySplit(*this, TEXT("Fields"), ToBytes(TEXT(": ping\n\ndata: hello\n\nevent: update\ndata:a\ndata:  b\ndata\n\n")));
+        TestEqual(TEXT("Fields: event count"), Stream.Events.Num(), 2);
+        TestEvent(*this, TEXT("Fields: first"), Stream, 0, TEXT("message"), TEXT("hello"), TEXT(""));
+        TestEvent(*this, TEXT("Fields: second"), Stream, 1, TEXT("update"), TEXT("a\n b\n"), TEXT(""));
+    }
+
+    // CRLF, CR and LF line endings, including a CRLF cut between its two bytes
+    {
+        const FParsedStream Stream = ParseEverySplit(*this, TEXT("Line endings"), ToBytes(TEXT("data: crlf\r\n\r\ndata: cr\r\rdata: lf\n\n")));
+        TestEqual(TEXT("Line endings: event count"), Stream.Events.Num(), 3);
+        TestEvent(*this, TEXT("Line endings: CRLF"), Stream, 0, TEXT("message"), TEXT("crlf"), TEXT(""));
+        TestEvent(*this, TEXT("Line endings: CR"), Stream, 1, TEXT("message"), TEXT("cr"), TEXT(""));
+        TestEvent(*this, TEXT("Line endings: LF"), Stream, 2, TEXT("message"), TEXT("lf"), TEXT(""));
+    }
+
+    // Multi-byte UTF-8 characters cut anywhere
+    {
+        const FParsedStream Stream = ParseEverySplit(*this, TEXT("UTF-8"), ToBytes(TEXT("data: h\u00E9llo \u20AC\n\n")));
+        TestEvent(*this, TEXT("UTF-8"), Stream, 0, TEXT("message"), TEXT("h\u00E9llo \u20AC"), TEXT(""));
+    }
+
+    // A byte order mark is skipped at the start of the stream only
+    {
+        const uint8 Bom[] = { 0xEF, 0xBB, 0xBF };
+        TArray<uint8> Bytes(Bom, UE_ARRAY_COUNT(Bom));
+        AppendText(Bytes, TEXT("data: first\n\n"));
+        Bytes.Append(Bom, UE_ARRAY_COUNT(Bom));
+        AppendText(Bytes, TEXT("data: second\n\n"));
+
+        const FParsedStream Stream = ParseEverySplit(*this, TEXT("BOM"), Bytes);
+        TestEqual(TEXT("BOM: a mid-stream BOM makes the field unknown"), Stream.Events.Num(), 1);
+        TestEvent(*this, TEXT("BOM"), Stream, 0, TEXT("message"), TEXT("first"), TEXT(""));
+
+        // A new connection is a new stream, so its BOM is skipped again
+        MasterHttp::FServerEventParser Parser(1024);
+        FParsedStream Reconnected;
+        FeedInPieces(Parser, ToBytes(TEXT("data: x\n\n")), {}, Reconnected);
+        Parser.Reset();
+        TArray<uint8> Second(Bom, UE_ARRAY_COUNT(Bom));
+        AppendText(Second, TEXT("data: y\n\n"));
+        FeedInPieces(Parser, Second, {}, Reconnected);
+        TestEqual(TEXT("BOM: skipped after Reset"), Reconnected.Events.Num(), 2);
+    }
+
+    // An id only becomes the last event id when its event is dispatched
+    {
+        const FParsedStream Stream = ParseEverySplit(*this, TEXT("Pending id"), ToBytes(TEXT("id: 1\ndata: a\n\ndata: b\n\nid: 2\ndata: c\n")));
+        TestEqual(TEXT("Pending id: event count"), Stream.Events.Num(), 2);
+        TestEvent(*this, TEXT("Pending id: first"), Stream, 0, TEXT("message"), TEXT("a"), TEXT("1"));
+        TestEvent(*this, TEXT("Pending id: second keeps the id"), Stream, 1, TEXT("message"), TEXT("b"), TEXT("1"));
+        TestEqual(TEXT("Pending id: undispatched id is not the last event id"), Stream.LastEventId, FString(TEXT("1")));
+
+        // The connection drops mid-event: the pending id is forgotten
+        MasterHttp::FServerEventParser Parser(1024);
+        FParsedStream Resumed;
+        FeedInPieces(Parser, ToBytes(TEXT("id: 1\ndata: a\n\nid: 2\ndata: c\n")), {}, Resumed);
+        Parser.Reset();
+        FeedInPieces(Parser, ToBytes(TEXT("data: d\n\n")), {}, Resumed);
+        TestEvent(*this, TEXT("Pending id: after Reset"), Resumed, 1, TEXT("message"), TEXT("d"), TEXT("1"));
+        TestEqual(TEXT("Pending id: after Reset"), Resumed.LastEventId, FString(TEXT("1")));
+    }
+
+    // An event without data is not dispatched, but its id still counts; an empty id clears it
+    {
+        FParsedStream Stream = ParseEverySplit(*this, TEXT("Id only"), ToBytes(TEXT("id: 7\n\n")));
+        TestEqual(TEXT("Id only: nothing dispatched"), Stream.Events.Num(), 0);
+        TestEqual(TEXT("Id only: last event id"), Stream.LastEventId, FString(TEXT("7")));
+
+        Stream = ParseEverySplit(*this, TEXT("Empty id"), ToBytes(TEXT("id: 7\n\nid\n\n")));
+        TestEqual(TEXT("Empty id: last event id cleared"), Stream.LastEventId, FString());
+    }
+
+    // An id containing NUL is ignored
+    {
+        TArray<uint8> Bytes = ToBytes(TEXT("id: 3\ndata: a\n\nid: a"));
+        Bytes.Add(0);
+        AppendText(Bytes, TEXT("b\ndata: b\n\n"));
+
+        const FParsedStream Stream = ParseEverySplit(*this, TEXT("NUL id"), Bytes);
+        TestEvent(*this, TEXT("NUL id"), Stream, 1, TEXT("message"), TEXT("b"), TEXT("3"));
+        TestEqual(TEXT("NUL id: last event id"), Stream.LastEventId, FString(TEXT("3")));
+    }
+
+    // retry: takes ASCII digits only; anything else leaves the previous value
+    {
+        TestEqual(TEXT("Retry: digits"), ParseEverySplit(*this, TEXT("Retry"), ToBytes(TEXT("retry: 2500\n"))).RetryMilliseconds, 2500);
+        const TCHAR* Invalid[] = { TEXT("+5"), TEXT("-1"), TEXT("1.5"), TEXT("1e3"), TEXT("abc"), TEXT(""), TEXT(" 5") };
+        for (const TCHAR* Value : Invalid)
+        {
+            const FString Text = FString::Printf(TEXT("retry: 2500\nretry: %s\n"), Value);
+            TestEqual(FString::Printf(TEXT("Retry: \"%s\" is ignored"), Value), ParseEverySplit(*this, TEXT("Retry"), ToBytes(Text)).RetryMilliseconds, 2500);
+        }
+    }
+
+    // Lines longer than MaxLineBytes stop the stream, however they are split
+    {
+        FParsedStream Stream = ParseEverySplit(*this, TEXT("Line limit"), ToBytes(TEXT("data: 0123456789\n\n")), 16);
+        TestTrue(TEXT("Line limit: a line of exactly the maximum is accepted"), Stream.bWithinLineLimit);
+        TestEvent(*this, TEXT("Line limit"), Stream, 0, TEXT("message"), TEXT("0123456789"), TEXT(""));
+
+        Stream = ParseEverySplit(*this, TEXT("Line limit"), ToBytes(TEXT("data: 0123456789a\n\n")), 16);
+        TestFalse(TEXT("Line limit: a longer line is rejected"), Stream.bWithinLineLimit);
+        TestEqual(TEXT("Line limit: nothing dispatched"), Stream.Events.Num(), 0);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,182 @@
+/*
+==========================================================================================
+File: MasterJsonPathTests.cpp
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "MasterJsonPath.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MasterJsonPathTests
+{
+    using MasterHttp::FJsonPathSegment;
+
+    /** Segments written as "key", "[3]" or "*", joined with spaces, so a whole parse fits in one comparison. */
+    static FString DescribeSegments(const TArray<FJsonPathSegment>& Segments)
+    {
+        TArray<FString> Parts;
+        for (const FJsonPathSegment& Segment : Segments)
+        {
+            switch (Segment.Kind)
+            {
+                case FJsonPathSegment::EKind::Key:      Parts.Add(Segment.Key); break;
+                case FJsonPathSegment::EKind::Index:    Parts.Add(FString::Printf(TEXT("[%d]"), Segment.Index)); break;
+                case FJsonPathSegment::EKind::Wildcard: Parts.Add(TEXT("*")); break;
+            }
+        }
+        return FString::Join(Parts, TEXT(" "));
+    }
+
+    static void TestParse(FAutomationTestBase& Test, const FString& Path, const FString& Expected)
+    {
+        TArray<FJsonPathSegment> Segments;
+        if (!MasterHttp::ParseJsonPath(Path, Segments))
+        {
+            Test.AddError(FString::Printf(TEXT("\"%s\" failed to parse"), *Path));
+            return;
+        }
+        Test.TestEqual(FString::Printf(TEXT("Segments of \"%s\""), *Path), DescribeSegments(Segments), Expected);
+    }
+
+    /** Matched values as text: strings as-is, numbers as integers, "{}" and "[]" for containers. */
+    static FString DescribeValue(const TSharedPtr<FJsonValue>& Value)
+    {
+        switch (Value->Type)
+        {
+            case EJson::Object: return TEXT("{}");
+            case EJson::Array:  return TEXT("[]");
+            case EJson::Number: return FString::FromInt(static_cast<int32>(Value->AsNumber()));
+            default:            return Value->AsString();
+        }
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMasterJsonPathParseTest, "MasterHttp.JsonPath.Parse", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMasterJsonPathParseTest::RunTest(const FString& Parameters)
+{
+    using namespace MasterJsonPathTests;
+
+    TestParse(*this, TEXT(""), TEXT(""));
+    TestParse(*this, TEXT("data.user.email"), TEXT("data user email"));
+    TestParse(*this, TEXT("items[3].id"), TEXT("items [3] id"));
+    TestParse(*this, TEXT("items[-1]"), TEXT("items [-1]"));
+    TestParse(*this, TEXT("items[ 2 ]"), TEXT("items [2]"));
+    TestParse(*this, TEXT("items[*].price"), TEXT("items * price"));
+    TestParse(*this, TEXT("stats.*.value"), TEXT("stats * value"));
+    TestParse(*this, TEXT("[0][1]"), TEXT("[0] [1]"));
+
+    // A leading "$" is the root only when followed by nothing, "." or "["
+    TestParse(*this, TEXT("$"), TEXT(""));
+    TestParse(*this, TEXT("$.a"), TEXT("a"));
+    TestParse(*this, TEXT("$[0]"), TEXT("[0]"));
+    TestParse(*this, TEXT("$ref"), TEXT("$ref"));
+    TestParse(*this, TEXT("a.$b"), TEXT("a $b"));
+
+    // Empty keys are skipped
+    TestParse(*this, TEXT("a..b"), TEXT("a b"));
+    TestParse(*this, TEXT(".a."), TEXT("a"));
+
+    const TCHAR* Malformed[] = { TEXT("items[x]"), TEXT("items[2"), TEXT("items[]"), TEXT("items[-]"), TEXT("items[+1]"), TEXT("items[1.5]"), TEXT("items[1]["), TEXT("[") };
+    for (const TCHAR* Path : Malformed)
+    {
+        TArray<FJsonPathSegment> Segments;
+        TestFalse(FString::Printf(TEXT("\"%s\" is rejected"), Path), MasterHttp::ParseJsonPath(Path, Segments));
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMasterJsonPathQueryTest, "MasterHttp.JsonPath.Query", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMasterJsonPathQueryTest::RunTest(const FString& Parameters)
+{
+    using namespace MasterJsonPathTests;
+
+    const FString Json = TEXT(R"({
+        "items": [ { "id": 1, "price": 10 }, { "id": 2, "price": 20 }, { "id": 3 } ],
+        "stats": { "hp": { "value": 5 }, "mp": { "value": 7 }, "xp": 3 },
+        "$ref": "r",
+        "a": { "b": "ab" }
+    })");
+    TSharedPtr<FJsonValue> Root;
+    if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid())
+    {
+        AddError(TEXT("Test document failed to parse"));
+        return false;
+    }
+
+    struct FCase
+    {
+        const TCHAR* Path;
+        const TCHAR* Expected;  // Matches in order, joined with spaces
+    };
+    const FCase Cases[] = {
+        { TEXT("items[*].id"),      TEXT("1 2 3") },
+        { TEXT("items[*].price"),   TEXT("10 20") },    // Shares "items[*]" with the path above
+        { TEXT("items[0].id"),      TEXT("1") },
+        { TEXT("items[0].id"),      TEXT("1") },        // The same path twice: both are answered
+        { TEXT("items[-1].id"),     TEXT("3") },
+        { TEXT("items[-3].id"),     TEXT("1") },
+        { TEXT("items[-4]"),        TEXT("") },
+        { TEXT("items[3]"),         TEXT("") },
+        { TEXT("items.*"),          TEXT("{} {} {}") }, // Wildcard over an array
+        { TEXT("stats.*.value"),    TEXT("5 7") },      // Wildcard over an object; "xp" has no "value"
+        { TEXT("stats.*"),          TEXT("{} {} 3") },
+        { TEXT("stats[0]"),         TEXT("") },         // Index into an object
+        { TEXT("items.id"),         TEXT("") },         // Key into an array
+        { TEXT("$"),                TEXT("{}") },
+        { TEXT("$.a.b"),            TEXT("ab") },
+        { TEXT("$ref"),             TEXT("r") },
+        { TEXT("a..b"),             TEXT("ab") },
+        { TEXT("a.b.c"),            TEXT("") },         // Past a leaf
+        { TEXT("missing"),          TEXT("") },
+        { TEXT("items[x]"),         TEXT("") },         // Malformed: never matches
+    };
+
+    const int32 CaseCount = UE_ARRAY_COUNT(Cases);
+    TArray<FString> Paths;
+    for (const FCase& Case : Cases)
+    {
+        Paths.Add(Case.Path);
+    }
+    const MasterHttp::FJsonPathQuery Query(Paths);
+
+    TArray<TArray<FString>> Matches;
+    Matches.SetNum(Paths.Num());
+    Query.Evaluate(Root, [&Matches](int32 PathIndex, const TSharedPtr<FJsonValue>& Value) {
+        Matches[PathIndex].Add(DescribeValue(Value));
+    });
+
+    for (int32 i = 0; i < CaseCount; ++i)
+    {
+        TestEqual(FString::Printf(TEXT("Matches of \"%s\" (path %d)"), Cases[i].Path, i), FString::Join(Matches[i], TEXT(" ")), FString(Cases[i].Expected));
+    }
+
+    TestTrue(TEXT("Well-formed paths are valid"), Query.IsValidPath(0));
+    TestFalse(TEXT("Malformed path is invalid"), Query.IsValidPath(CaseCount - 1));
+    TestFalse(TEXT("Not every path is valid"), Query.AreAllPathsValid());
+
+    // Single-step resolution, as used by DecodeJson for paths without wildcards
+    TArray<FJsonPathSegment> Segments;
+    MasterHttp::ParseJsonPath(TEXT("items[-2]"), Segments);
+    const TSharedPtr<FJsonValue> Items = MasterHttp::ResolveJsonSegment(Root, Segments[0]);
+    const TSharedPtr<FJsonValue> Second = MasterHttp::ResolveJsonSegment(Items, Segments[1]);
+    TestTrue(TEXT("Negative index resolves from the end"), Second.IsValid() && Second->Type == EJson::Object && Second->AsObject()->GetIntegerField(TEXT("id")) == 2);
+
+    MasterHttp::ParseJsonPath(TEXT("items.*"), Segments);
+    TestFalse(TEXT("A wildcard never resolves to a single value"), MasterHttp::ResolveJsonSegment(Items, Segments[1]).IsValid());
+    TestFalse(TEXT("Resolving from nothing gives nothing"), MasterHttp::ResolveJsonSegment(nullptr, Segments[0]).IsValid());
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
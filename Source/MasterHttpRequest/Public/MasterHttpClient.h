@@ -0,0 +1,187 @@
+/*
+==========================================================================================
+File: MasterHttpClient.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Async/Future.h"
+#include "MasterHttpRequestBPLibrary.h"
+#include "MasterHttpClient.generated.h"
+
+/** Outcome of a request as seen by the plugin pipeline. */
+struct FMasterHttpResult
+{
+    FHttpResponsePtr Response;
+    bool bWasSuccessful = false;
+    int64 RequestId = 0;                    // Unique per submitted request; shared by requests answered together
+    FString FinalURL;
+    double StartTime = 0.0;                 // FPlatformTime::Seconds() when the first attempt started
+    TArray<FHttpAttemptInfo> Attempts;      // One entry per network attempt (empty when served from the cache)
+
+    EHttpErrorKind LocalError = EHttpErrorKind::None;   // Set when the plugin failed the request without a response
+    FString LocalErrorMessage;
+
+    int64 BytesSent = 0;                    // Request body bytes as sent (compressed size when gzip was applied)
+    int64 BytesSentUncompressed = -1;       // Request body bytes before compression; -1 if it was not compressed
+    int64 BytesReceived = -1;               // Response body bytes as received; -1 means the same as the decoded body
+
+    double SubmitTime = 0.0;                // FPlatformTime::Seconds() when the request entered the pipeline
+    double CompletedTime = 0.0;             // When the pipeline finished with it, before the callback was dispatched
+    FHttpTimingBreakdown Timing;            // Network phases; delivery and total are filled in by MakeResponse
+};
+
+/** Native completion used by the plugin pipeline. */
+using FMasterHttpNativeComplete = TFunction<void(const FMasterHttpResult& Result)>;
+
+/** Called with the built engine request right before it is processed, to attach streams or progress delegates. */
+using FMasterHttpConfigureRequest = TFunction<void(const FHttpRequestRef& HttpRequest)>;
+
+/** Copy of the client properties a request is built from, so it can be submitted from any thread (C++ only). */
+struct FMasterHttpClientSettings
+{
+    FString BaseURL;
+    TArray<FHttpHeaderEnumValue> DefaultHeaders;
+    TArray<FHttpKeyValue> DefaultCustomHeaders;
+    int32 MaxConnectionsPerHost = 6;
+};
+
+/**
+ * A long-lived HTTP client holding a base URL, default headers and options.
+ * Requests to the same host are capped at MaxConnectionsPerHost, a concurrency limit shared with every other client;
+ * extra requests wait in the module's request scheduler. Connection reuse is left to the engine's HTTP module.
+ * The static SendHttpRequest / QuickGet / QuickPost functions go through GetDefaultHttpClient().
+ */
+UCLASS(BlueprintType)
+class MASTERHTTPREQUEST_API UMasterHttpClient : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /** Prepended to relative request URLs (e.g. "https://api.example.com/v1"). */
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP Request | Client")
+    FString BaseURL;
+
+    /** Enum-based headers sent with every request (request headers override them). */
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP Request | Client")
+    TArray<FHttpHeaderEnumValue> DefaultHeaders;
+
+    /** Custom headers sent with every request (request headers override them). */
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP Request | Client")
+    TArray<FHttpKeyValue> DefaultCustomHeaders;
+
+    /** Options used by SendRequest. */
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP Request | Client")
+    FHttpOptions DefaultOptions;
+
+    /**
+    * Per-host cap this client's requests are checked against before they start. The count includes requests to
+    * the host from every client, so two clients with a cap of 6 share the same 6 slots. The scheduler's own host
+    * limit also applies.
+    */
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP Request | Client")
+    int32 MaxConnectionsPerHost = 6;
+
+    /**
+    * Create a new client.
+    * @param InBaseURL - Base URL for relative request paths (optional).
+    * @param Options - Default options for requests sent with SendRequest.
+    * @param InMaxConnectionsPerHost - Per-host cap for this client's requests (counted across all clients).
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Client")
+    static UMasterHttpClient* CreateHttpClient(const FString& InBaseURL, FHttpOptions Options, int32 InMaxConnectionsPerHost = 6);
+
+    /** The shared client used by the static request functions. */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Client")
+    static UMasterHttpClient* GetDefaultHttpClient();
+
+    /**
+    * Send a request using the client's default options.
+    * @param Path - Path relative to BaseURL, or an absolute URL.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Client")
+    FHttpRequestHandle SendRequest(
+        const FString& Path,
+        EHttpMethod Method,
+        TArray<FHttpHeaderEnumValue> Headers,
+        TArray<FHttpKeyValue> CustomHeaders,
+        TArray<FHttpKeyValue> QueryParams,
+        TArray<FHttpKeyValue> Body,
+        FHttpResponseDelegate Callback
+    );
+
+    /** Send a fully described request (its own options are used as-is). */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Client")
+    FHttpRequestHandle SendRequestDescriptor(const FHttpRequestDescriptor& Request, FHttpResponseDelegate Callback);
+
+    /** Number of requests currently in flight to a host (across all clients). */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Client")
+    int32 GetActiveRequestCount(const FString& Host) const;
+
+    /** Number of requests waiting for a free slot on a host (across all clients). */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Client")
+    int32 GetPendingRequestCount(const FString& Host) const;
+
+    /**
+    * Build the request (base URL, client defaults), wait for a scheduler slot and process it (C++ only).
+    * @param bCompleteOnHttpThread - Invoke OnComplete on the HTTP thread instead of the game thread.
+    * @param OnConfigure - Optional hook run on the engine request just before it is sent.
+    * @return Handle of the request; OnComplete runs exactly once, with LocalError Cancelled if it was cancelled.
+    */
+    FHttpRequestHandle ProcessRequest(FHttpRequestDescriptor Request, bool bCompleteOnHttpThread, FMasterHttpNativeComplete OnComplete, FMasterHttpConfigureRequest OnConfigure = nullptr);
+
+    /** Same as ProcessRequest, using a settings snapshot instead of a client. Safe to call from any thread (C++ only). */
+    static FHttpRequestHandle ProcessRequest(const FMasterHttpClientSettings& Settings, FHttpRequestDescriptor Request, bool bCompleteOnHttpThread, FMasterHttpNativeComplete OnComplete, FMasterHttpConfigureRequest OnConfigure = nullptr);
+
+    /** Snapshot of the properties requests are built from, for ProcessRequest off the game thread (C++ only). */
+    FMasterHttpClientSettings GetSettings() const;
+
+    /**
+    * Send a request and get its response as a future (C++ only).
+    * The future is fulfilled on the HTTP thread as soon as the response is converted, without waiting for a game
+    * thread tick. Rate-limit waits and retry backoff are still timed by the core ticker, on the game thread.
+    * @param OutHandle - Optional, receives the request's handle.
+    */
+    TFuture<FHttpResponseSimple> SendAsync(FHttpRequestDescriptor Request, FHttpRequestHandle* OutHandle = nullptr);
+
+    /**
+    * Send a dependent request once Previous completes, from the thread that completed it (C++ only). The client's
+    * settings are copied when SendAfter is called, so chains such as login -> token -> profile never wait for the
+    * game thread between steps, and later changes to the client do not affect them:
+    *   Client->SendAfter(Client->SendAsync(Login), [](const FHttpResponseSimple& Token) { return MakeProfileRequest(Token); });
+    * @param Next - Builds the next request from the previous response. Runs on a worker thread. Return an unset
+    *               optional to stop the chain there; a failed response stops the chain without calling Next.
+    * @return Future of the last response in the chain.
+    */
+    TFuture<FHttpResponseSimple> SendAfter(TFuture<FHttpResponseSimple>&& Previous, TFunction<TOptional<FHttpRequestDescriptor>(const FHttpResponseSimple&)> Next);
+
+    /** Completion that converts the engine response, logs it per the request's debug level and fires Callback (C++ only). */
+    static FMasterHttpNativeComplete MakeDelegateCompletion(const FHttpRequestDescriptor& Request, FHttpResponseDelegate Callback);
+
+    /** Same as MakeDelegateCompletion, handing the converted response to a native callback on the completing thread (C++ only). */
+    static FMasterHttpNativeComplete MakeNativeCompletion(const FHttpRequestDescriptor& Request, TFunction<void(FHttpResponseSimple&&)> OnResponse);
+
+    /** Resolve a path against BaseURL. Absolute URLs are returned unchanged. */
+    FString ResolveURL(const FString& Path) const;
+
+private:
+    /** Shared body of both ProcessRequest overloads; the client properties are passed in, so nothing here reads the UObject. */
+    static FHttpRequestHandle ProcessRequestWith(const FString& InBaseURL, const TArray<FHttpHeaderEnumValue>& InDefaultHeaders, const TArray<FHttpKeyValue>& InDefaultCustomHeaders, int32 InMaxConnectionsPerHost,
+        FHttpRequestDescriptor Request, bool bCompleteOnHttpThread, FMasterHttpNativeComplete OnComplete, FMasterHttpConfigureRequest OnConfigure);
+
+    /** Resolve a path against a base URL. */
+    static FString ResolveURL(const FString& InBaseURL, const FString& Path);
+
+    /**
+    * Serve a fresh cached response, or make the request conditional and wrap OnComplete to store / revalidate the result.
+    * @return False if the request was answered from the cache and must not be sent.
+    */
+    static bool ApplyResponseCache(FHttpRequestDescriptor& Request, int64 RequestId, bool bCompleteOnHttpThread, FMasterHttpNativeComplete& OnComplete);
+};
@@ -11,6 +11,15 @@ Publisher: MJGT Studio
 
 #include "Modules/ModuleManager.h"
 
+class UMasterHttpClient;
+class FMasterHttpScheduler;
+class FMasterHttpResponseCache;
+class FMasterHttpCoalescer;
+class FMasterHttpHostGuard;
+class FMasterHttpDebugLog;
+class FMasterHttpMetrics;
+class FMasterHttpRequestRegistry;
+
 class FMasterHttpRequestModule : public IModuleInterface
 {
 public:
@@ -18,4 +27,46 @@ public:
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+	/** Access the loaded module instance. Safe on any thread: SendAfter submits requests from the HTTP thread. */
+	static FMasterHttpRequestModule& Get()
+	{
+		return IsInGameThread()
+			? FModuleManager::LoadModuleChecked<FMasterHttpRequestModule>("MasterHttpRequest")
+			: FModuleManager::GetModuleChecked<FMasterHttpRequestModule>("MasterHttpRequest");
+	}
+
+	/** Shared client used by the static request functions, created on first use (game thread). */
+	UMasterHttpClient* GetDefaultClient();
+
+	/** Request scheduler shared by every client. Capture the shared pointer when it must outlive the call. */
+	TSharedRef<FMasterHttpScheduler, ESPMode::ThreadSafe> GetScheduler() const { return Scheduler.ToSharedRef(); }
+
+	/** Response cache used by requests whose CachePolicy is not None. */
+	TSharedRef<FMasterHttpResponseCache, ESPMode::ThreadSafe> GetResponseCache() const { return ResponseCache.ToSharedRef(); }
+
+	/** Shares identical in-flight GETs for requests with bCoalesceInFlight. */
+	TSharedRef<FMasterHttpCoalescer, ESPMode::ThreadSafe> GetCoalescer() const { return Coalescer.ToSharedRef(); }
+
+	/** Per-host rate limiter and circuit breaker. */
+	TSharedRef<FMasterHttpHostGuard, ESPMode::ThreadSafe> GetHostGuard() const { return HostGuard.ToSharedRef(); }
+
+	/** Background writer for Detailed / Verbose debug reports. */
+	TSharedRef<FMasterHttpDebugLog, ESPMode::ThreadSafe> GetDebugLog() const { return DebugLog.ToSharedRef(); }
+
+	/** Per-host / per-route request counters and latency histograms. */
+	TSharedRef<FMasterHttpMetrics, ESPMode::ThreadSafe> GetMetrics() const { return Metrics.ToSharedRef(); }
+
+	/** Unfinished requests, for cancellation by tag or all at once. */
+	TSharedRef<FMasterHttpRequestRegistry, ESPMode::ThreadSafe> GetRequestRegistry() const { return RequestRegistry.ToSharedRef(); }
+
+private:
+	UMasterHttpClient* DefaultClient = nullptr;
+	TSharedPtr<FMasterHttpScheduler, ESPMode::ThreadSafe> Scheduler;
+	TSharedPtr<FMasterHttpResponseCache, ESPMode::ThreadSafe> ResponseCache;
+	TSharedPtr<FMasterHttpCoalescer, ESPMode::ThreadSafe> Coalescer;
+	TSharedPtr<FMasterHttpHostGuard, ESPMode::ThreadSafe> HostGuard;
+	TSharedPtr<FMasterHttpDebugLog, ESPMode::ThreadSafe> DebugLog;
+	TSharedPtr<FMasterHttpMetrics, ESPMode::ThreadSafe> Metrics;
+	TSharedPtr<FMasterHttpRequestRegistry, ESPMode::ThreadSafe> RequestRegistry;
 };
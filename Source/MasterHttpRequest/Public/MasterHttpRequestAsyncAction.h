@@ -0,0 +1,91 @@
+/*
+==========================================================================================
+File: MasterHttpRequestAsyncAction.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "Containers/Ticker.h"
+#include "MasterHttpRequestBPLibrary.h"
+#include "MasterHttpRequestAsyncAction.generated.h"
+
+class UMasterHttpClient;
+
+/** Output pins of the latent request node. Response is empty on OnProgress; the byte counts are filled on every pin. */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FHttpAsyncRequestPin, FHttpResponseSimple, Response, int64, BytesReceived, int64, BytesExpected);
+
+/**
+ * Latent Blueprint node for a request: the graph continues from OnSuccess or OnFailure when the response arrives,
+ * instead of binding a callback event. OnProgress fires on the game thread while the body downloads.
+ * A cancelled request (CancelHttpRequestsByTag, Cancel) continues from OnFailure with ErrorKind Cancelled.
+ */
+UCLASS()
+class MASTERHTTPREQUEST_API UMasterHttpRequestAsyncAction : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    /** The request completed with a 2xx status. */
+    UPROPERTY(BlueprintAssignable)
+    FHttpAsyncRequestPin OnSuccess;
+
+    /** The request failed: no response, an error status, or cancelled. Response.ErrorKind tells which. */
+    UPROPERTY(BlueprintAssignable)
+    FHttpAsyncRequestPin OnFailure;
+
+    /** More of the response arrived. BytesExpected is 0 while the size is unknown. */
+    UPROPERTY(BlueprintAssignable)
+    FHttpAsyncRequestPin OnProgress;
+
+    /**
+    * Send an HTTP request as a latent node with success, failure and progress outputs.
+    * Parameters are the same as SendHttpRequest.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Send HTTP Request (Async)"))
+    static UMasterHttpRequestAsyncAction* SendHttpRequestAsync(
+        UObject* WorldContextObject,
+        const FString& URL,
+        EHttpMethod Method,
+        TArray<FHttpHeaderEnumValue> DefaultHeaders,
+        TArray<FHttpKeyValue> CustomHeaders,
+        TArray<FHttpKeyValue> QueryParams,
+        TArray<FHttpKeyValue> Body,
+        FHttpOptions Options
+    );
+
+    /**
+    * Send a request descriptor as a latent node.
+    * @param Client - Client to send through (base URL, default headers); the default client when empty.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Send Request Descriptor (Async)"))
+    static UMasterHttpRequestAsyncAction* SendRequestDescriptorAsync(UObject* WorldContextObject, const FHttpRequestDescriptor& Request, UMasterHttpClient* Client = nullptr);
+
+    /** Cancel the request; the node continues from OnFailure. */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Async")
+    void Cancel();
+
+    /** Handle of the request once the node has been activated. */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Async")
+    FHttpRequestHandle GetRequestHandle() const { return Handle; }
+
+    virtual void Activate() override;
+    virtual void SetReadyToDestroy() override;
+
+private:
+    void HandleResponse(FHttpResponseSimple&& Response);
+    bool TickProgress(float DeltaTime);
+
+    FHttpRequestDescriptor Request;
+
+    UPROPERTY()
+    TObjectPtr<UMasterHttpClient> Client;
+
+    FHttpRequestHandle Handle;
+    FTSTicker::FDelegateHandle ProgressTicker;
+    int64 LastBytesReceived = -1;
+};
@@ -12,8 +12,11 @@ Publisher: MJGT Studio
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Json.h"
+#include "HttpFwd.h"
+#include "StructUtils/InstancedStruct.h"
 #include "MasterHttpRequestBPLibrary.generated.h"
 
+struct FMasterHttpRequestState;
 
 UENUM(BlueprintType)
 enum class EHttpMethod : uint8
@@ -59,6 +62,7 @@ enum class EContentType : uint8
     TextPlain               UMETA(DisplayName = "text/plain"),
     TextHtml                UMETA(DisplayName = "text/html"),
     TextXml                 UMETA(DisplayName = "text/xml"),
+    ApplicationOctetStream  UMETA(DisplayName = "application/octet-stream"),
     Custom                  UMETA(DisplayName = "Custom")
 };
 
@@ -71,6 +75,68 @@ enum class EDebugLevel : uint8
     Verbose     UMETA(DisplayName = "Verbose (All Details)")
 };
 
+UENUM(BlueprintType)
+enum class EHttpDebugLogFormat : uint8
+{
+    Text        UMETA(DisplayName = "Text Reports"),
+    Ndjson      UMETA(DisplayName = "NDJSON (One JSON Object Per Line)")
+};
+
+UENUM(BlueprintType)
+enum class EHttpRequestPriority : uint8
+{
+    Critical    UMETA(DisplayName = "Critical (Gameplay)"),
+    Normal      UMETA(DisplayName = "Normal"),
+    Background  UMETA(DisplayName = "Background (Telemetry, Bulk)")
+};
+
+UENUM(BlueprintType)
+enum class EHttpCachePolicy : uint8
+{
+    None            UMETA(DisplayName = "No Cache"),
+    Memory          UMETA(DisplayName = "Memory"),
+    MemoryAndDisk   UMETA(DisplayName = "Memory + Disk")
+};
+
+UENUM(BlueprintType)
+enum class EHttpMetricsExportFormat : uint8
+{
+    Csv     UMETA(DisplayName = "CSV"),
+    Json    UMETA(DisplayName = "JSON")
+};
+
+UENUM(BlueprintType)
+enum class EHttpErrorKind : uint8
+{
+    None                UMETA(DisplayName = "None"),
+    ConnectionFailed    UMETA(DisplayName = "Connection Failed"),
+    HttpStatus          UMETA(DisplayName = "HTTP Error Status"),
+    CircuitOpen         UMETA(DisplayName = "Circuit Open (Failed Fast)"),
+    DecodeFailed        UMETA(DisplayName = "Decode Failed"),
+    FileError           UMETA(DisplayName = "File Error"),
+    Cancelled           UMETA(DisplayName = "Cancelled"),
+    EncodeFailed        UMETA(DisplayName = "Request Body Encode Failed")
+};
+
+UENUM(BlueprintType)
+enum class EHttpCircuitState : uint8
+{
+    Closed      UMETA(DisplayName = "Closed (Healthy)"),
+    Open        UMETA(DisplayName = "Open (Failing Fast)"),
+    HalfOpen    UMETA(DisplayName = "Half-Open (Probing)")
+};
+
+UENUM(BlueprintType)
+enum class EHttpRequestState : uint8
+{
+    None        UMETA(DisplayName = "None (Invalid Handle)"),
+    Queued      UMETA(DisplayName = "Queued"),
+    InFlight    UMETA(DisplayName = "In Flight"),
+    Succeeded   UMETA(DisplayName = "Succeeded"),
+    Failed      UMETA(DisplayName = "Failed"),
+    Cancelled   UMETA(DisplayName = "Cancelled")
+};
+
 UENUM(BlueprintType)
 enum class EJsonDecodeResult : uint8
 {
@@ -135,6 +201,95 @@ struct FHttpOptions
 
     UPROPERTY(BlueprintReadWrite, Category = "HTTP")
     bool bVerifySSL = true;
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    EHttpRequestPriority Priority = EHttpRequestPriority::Normal;
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    bool bRawResponse = false; // Keep the body as bytes in Response.Content instead of converting it into Response.Data
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    EHttpCachePolicy CachePolicy = EHttpCachePolicy::None; // GET responses honoring Cache-Control / ETag / Last-Modified
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    bool bCoalesceInFlight = false; // Share one network call between identical GET requests already in flight
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    int32 MaxAttempts = 1; // Total attempts including the first; 1 disables retries
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    bool bRetryIdempotentOnly = true; // Never retry POST / PATCH, which may not be safe to repeat
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    float RetryBaseDelaySeconds = 0.5f; // Backoff cap doubles per attempt from this value; the delay is random below the cap
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    float RetryMaxDelaySeconds = 30.0f;
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    bool bHonorRetryAfter = true; // Wait at least as long as the server's Retry-After header asks
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    bool bCompressRequestBody = false; // gzip the request body and send "Content-Encoding: gzip" (the server must accept it)
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    int32 CompressionThresholdBytes = 1024; // Smaller bodies are sent uncompressed
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    bool bDecompressResponses = false; // Ask for gzip / deflate responses and decode them before the callback; the engine then completes on the HTTP thread
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    bool bSplitResponseHeaders = true; // Fill Response.Headers; turn off when headers are only read with GetResponseHeader
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    FName Tag; // Group name for CancelHttpRequestsByTag (e.g. "ShopScreen")
+};
+
+USTRUCT(BlueprintType)
+struct FHttpAttemptInfo
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int32 StatusCode = -1; // -1 if no response was received
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    float DurationSeconds = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    float DelayBeforeSeconds = 0.0f; // Backoff waited before this attempt
+};
+
+/**
+ * Where the time of a request went, in seconds. Phases the request never reached are 0; TimeToFirstByteSeconds is -1
+ * when no response arrived. DNS, connect and TLS are not reported separately by the engine's HTTP interface and are part
+ * of TimeToFirstByteSeconds.
+ */
+USTRUCT(BlueprintType)
+struct FHttpTimingBreakdown
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    float QueuedSeconds = 0.0f; // Waiting for a rate limit token or a scheduler slot, all attempts
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    float RetryDelaySeconds = 0.0f; // Backoff between attempts
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    float TimeToStartSeconds = 0.0f; // From the call until the last attempt was sent
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    float TimeToFirstByteSeconds = -1.0f; // From sending the last attempt until its response headers arrived
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    float DownloadSeconds = 0.0f; // From the response headers until the body was complete
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    float DeliverySeconds = 0.0f; // From completion until the callback: decoding and the hop to the game thread
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    float TotalSeconds = 0.0f; // From the call until the callback
 };
 
 USTRUCT(BlueprintType)
@@ -171,9 +326,290 @@ struct FHttpResponseSimple
 
     UPROPERTY(BlueprintReadOnly, Category = "HTTP")
     FString URL;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    TArray<uint8> Content; // Raw body, only filled when Options.bRawResponse is set
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    TArray<FHttpAttemptInfo> Attempts; // One entry per network attempt, including retries
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    EHttpErrorKind ErrorKind = EHttpErrorKind::None;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 BytesSent = 0; // Request body as sent on the wire
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 BytesSentUncompressed = 0; // Request body before compression
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 BytesReceived = 0; // Response body as received on the wire
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 BytesReceivedUncompressed = 0; // Response body after decoding
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    FHttpTimingBreakdown Timing;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 RequestId = 0; // Matches the "HTTP #<id>" region in Unreal Insights
+
+    /**
+    * Unsplit "Name: Value" header lines, kept only when Options.bSplitResponseHeaders is off so GetResponseHeader still works.
+    * Shared between copies of the response; the engine response and its body are not kept (C++ only).
+    */
+    TSharedPtr<const TArray<FString>, ESPMode::ThreadSafe> RawHeaderLines;
+};
+
+USTRUCT(BlueprintType)
+struct FHttpRequestDescriptor
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    FString URL;
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    EHttpMethod Method = EHttpMethod::GET;
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    TArray<FHttpHeaderEnumValue> DefaultHeaders;
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    TArray<FHttpKeyValue> CustomHeaders;
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    TArray<FHttpKeyValue> QueryParams;
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    TArray<FHttpKeyValue> Body;
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    TArray<uint8> BinaryBody; // Sent as-is instead of Body when not empty
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    FString JsonBody; // Sent as-is (UTF-8, never parsed or re-encoded) instead of Body when not empty
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    FHttpOptions Options;
+};
+
+USTRUCT(BlueprintType)
+struct FHttpMultipartPart
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    FString Name;
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    FString Value; // Text value, used when FilePath is empty
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    FString FilePath; // File streamed from disk as the part body
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    FString FileName; // Defaults to the file name of FilePath
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    FString ContentType; // Defaults to application/octet-stream for files
+};
+
+USTRUCT(BlueprintType)
+struct FHttpCacheStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int32 MemoryEntries = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 Hits = 0; // Served from cache without a request
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 Revalidated = 0; // 304 Not Modified answered from cache
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 Misses = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 DiskReads = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FHttpBatchResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    bool bAllSucceeded = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    TArray<FHttpResponseSimple> Responses; // Same order as the requests; RequestDurationSeconds is the per-item time
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int32 SucceededCount = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int32 FailedCount = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int32 SkippedCount = 0; // Not completed because the batch failed fast or was cancelled (ErrorKind Cancelled)
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    float TotalDurationSeconds = 0.0f;
+};
+
+USTRUCT(BlueprintType)
+struct FHttpMetricsEntry
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    FString Host;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    FString Route; // "GET /v1/items/{id}"; empty for per-host entries
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 Requests = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 Status2xx = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 Status3xx = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 Status4xx = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 Status5xx = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 Errors = 0; // No response: connection failures, fail-fast, local errors
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 BytesSent = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 BytesReceived = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    float MeanMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    float P50Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    float P95Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    float P99Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    float MaxMs = 0.0f;
+};
+
+USTRUCT(BlueprintType)
+struct FHttpSchedulerStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int32 InFlight = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int32 QueueDepth = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int32 QueuedCritical = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int32 QueuedNormal = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int32 QueuedBackground = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int32 PeakQueueDepth = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 TotalStarted = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    float AverageQueueWaitSeconds = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    float MaxQueueWaitSeconds = 0.0f;
+};
+
+/** One server-sent event, dispatched when its terminating blank line arrives. */
+USTRUCT(BlueprintType)
+struct FHttpServerEvent
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    FString Event = TEXT("message"); // "event:" field; "message" when the server did not name the event
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    FString Data; // "data:" lines joined with newlines
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    FString Id; // Last "id:" seen on the stream, sent back as Last-Event-ID when reconnecting
+};
+
+USTRUCT(BlueprintType)
+struct FHttpStreamOptions
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    bool bAutoReconnect = true; // Event streams: reconnect with Last-Event-ID when the connection drops or the server ends the stream
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    float ReconnectDelaySeconds = 3.0f; // Used until the server sends "retry:"; doubles after each failed reconnect
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    float MaxReconnectDelaySeconds = 60.0f;
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    int32 MaxReconnectAttempts = 0; // Consecutive reconnects without receiving an event before giving up; 0 = never give up
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    int32 MaxBufferedBytes = 1048576; // Received but not yet delivered data (and the longest line); beyond it the connection is dropped
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    float IdleTimeoutSeconds = 0.0f; // Drop (and reconnect) a connection that receives nothing for this long, heartbeats included; 0 = off
+
+    UPROPERTY(BlueprintReadWrite, Category = "HTTP")
+    FString LastEventId; // Resume an event stream from this id on the first connection
+};
+
+/**
+ * Refers to a submitted request, to cancel it or query its state and progress.
+ * Copies refer to the same request; a default-constructed handle refers to none.
+ */
+USTRUCT(BlueprintType)
+struct FHttpRequestHandle
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP")
+    int64 RequestId = 0; // Same id as Response.RequestId; 0 for an invalid handle
+
+    TSharedPtr<FMasterHttpRequestState, ESPMode::ThreadSafe> State;
+
+    bool IsValid() const { return State.IsValid(); }
 };
 
 DECLARE_DYNAMIC_DELEGATE_OneParam(FHttpResponseDelegate, FHttpResponseSimple, Response);
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FHttpProgressDelegate, int64, BytesTransferred, int64, TotalBytes);
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FHttpDecodedResponseDelegate, FHttpResponseSimple, Response, FInstancedStruct, DecodedStruct);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FHttpBatchDelegate, FHttpBatchResult, Result);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FHttpServerEventDelegate, FHttpServerEvent, Event);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FHttpStreamChunkDelegate, FString, Chunk);
 
 UCLASS()
 class UMasterHttpRequestBPLibrary : public UBlueprintFunctionLibrary
@@ -191,9 +627,10 @@ public:
     * @param Body - Array of key-value pairs for JSON body (optional).
     * @param Callback - Delegate called on completion.
     * @param Options - Advanced options (timeout, SSL, debug; optional, defaults applied).
+    * @return Handle to cancel the request or follow its progress (every send function returns one).
     */
     UFUNCTION(BlueprintCallable, Category = "HTTP Request")
-    static void SendHttpRequest(
+    static FHttpRequestHandle SendHttpRequest(
         const FString& URL,
         EHttpMethod Method,
         TArray<FHttpHeaderEnumValue> DefaultHeaders,
@@ -204,6 +641,249 @@ public:
         FHttpOptions Options
     );
 
+    /**
+    * Send an HTTP request with a raw byte body (images, protobuf, compressed blobs) sent without any string conversion.
+    * Set Options.ContentType to match the payload (e.g. application/octet-stream).
+    * @param Content - The request body.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request")
+    static FHttpRequestHandle SendHttpRequestBinary(
+        const FString& URL,
+        EHttpMethod Method,
+        TArray<FHttpHeaderEnumValue> DefaultHeaders,
+        TArray<FHttpKeyValue> CustomHeaders,
+        TArray<FHttpKeyValue> QueryParams,
+        TArray<uint8> Content,
+        FHttpResponseDelegate Callback,
+        FHttpOptions Options
+    );
+
+    /**
+    * Send an HTTP request and map the JSON response into a struct off the game thread.
+    * Parsing and struct conversion run on a worker thread; only the finished struct is passed back to the game thread.
+    * Response.Data is left empty unless decoding fails, in which case it holds the raw body for inspection.
+    * @param ResponseStruct - Struct type to decode the response body into.
+    * @param Callback - Delegate called on the game thread with the response and the decoded struct (invalid if decoding failed).
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request")
+    static FHttpRequestHandle SendHttpRequestDecoded(
+        const FString& URL,
+        EHttpMethod Method,
+        TArray<FHttpHeaderEnumValue> DefaultHeaders,
+        TArray<FHttpKeyValue> CustomHeaders,
+        TArray<FHttpKeyValue> QueryParams,
+        TArray<FHttpKeyValue> Body,
+        UScriptStruct* ResponseStruct,
+        FHttpDecodedResponseDelegate Callback,
+        FHttpOptions Options
+    );
+
+    /**
+    * C++ version of SendHttpRequestDecoded. Use FInstancedStruct::GetPtr<T>() to read the result.
+    */
+    static FHttpRequestHandle SendHttpRequestDecodedNative(
+        const FHttpRequestDescriptor& Request,
+        const UScriptStruct* ResponseStruct,
+        TFunction<void(const FHttpResponseSimple&, const FInstancedStruct&)> OnDecoded
+    );
+
+    /**
+    * Send a request whose body is a ready-made JSON document. The text is sent as-is, so numbers, booleans and nested values keep their types.
+    * @param JsonBody - JSON text to send (not parsed or validated).
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request")
+    static FHttpRequestHandle SendHttpRequestJson(
+        const FString& URL,
+        EHttpMethod Method,
+        TArray<FHttpHeaderEnumValue> DefaultHeaders,
+        TArray<FHttpKeyValue> CustomHeaders,
+        TArray<FHttpKeyValue> QueryParams,
+        const FString& JsonBody,
+        FHttpResponseDelegate Callback,
+        FHttpOptions Options
+    );
+
+    /**
+    * Send a struct as the JSON body, serialized field by field with its real types (FJsonObjectConverter naming rules apply).
+    * @param Body - Any struct; make it with "Make Instanced Struct".
+    * If Body is empty or cannot be serialized, nothing is sent: Callback runs with ErrorKind EncodeFailed and the
+    * returned handle is invalid.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request")
+    static FHttpRequestHandle SendHttpRequestStruct(
+        const FString& URL,
+        EHttpMethod Method,
+        TArray<FHttpHeaderEnumValue> DefaultHeaders,
+        TArray<FHttpKeyValue> CustomHeaders,
+        TArray<FHttpKeyValue> QueryParams,
+        const FInstancedStruct& Body,
+        FHttpResponseDelegate Callback,
+        FHttpOptions Options
+    );
+
+    /**
+    * Serialize a struct to compact JSON, for a descriptor's JsonBody.
+    * @return False if the struct is empty or could not be serialized.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Helpers")
+    static bool StructToJsonBody(const FInstancedStruct& Struct, FString& JsonBody);
+
+    /** Serialize a struct into Request.JsonBody (C++). */
+    static bool SetJsonBodyFromStruct(FHttpRequestDescriptor& Request, const UScriptStruct* Struct, const void* Data);
+
+    /** Serialize a struct into Request.JsonBody (C++). */
+    template<typename TStruct>
+    static bool SetJsonBodyFromStruct(FHttpRequestDescriptor& Request, const TStruct& Body)
+    {
+        return SetJsonBodyFromStruct(Request, TStruct::StaticStruct(), &Body);
+    }
+
+    /**
+    * Send independent requests together and get one callback with every response, in request order.
+    * @param Requests - Requests to send (build them with MakeRequestDescriptor).
+    * @param MaxConcurrency - How many of them may be in flight at once (the scheduler's limits also apply).
+    * @param bFailFast - Complete the batch on the first failure; requests not started are skipped and those in flight are cancelled.
+    * @param Callback - Called once on the game thread when every request has completed.
+    * @param Tag - Group name for CancelHttpRequestsByTag; cancels the whole batch.
+    * @return Handle of the batch. Cancelling it cancels every unfinished request and calls Callback with them skipped.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request")
+    static FHttpRequestHandle SendHttpRequestBatch(
+        const TArray<FHttpRequestDescriptor>& Requests,
+        FHttpBatchDelegate Callback,
+        int32 MaxConcurrency = 6,
+        bool bFailFast = false,
+        FName Tag = NAME_None
+    );
+
+    /**
+    * Download a URL straight to a file, writing the body to disk as it arrives instead of buffering it in memory.
+    * The body is written to "<FilePath>.part" and moved to FilePath once the download succeeds.
+    * @param FilePath - Destination file (absolute, or relative to the project directory).
+    * @param bResume - Continue a previous partial download with a Range request; a server that ignores the range restarts it.
+    * @param OnProgress - Called on the game thread with the bytes written so far and the expected total (0 if unknown).
+    * @param Callback - Called on completion. Response.Data is empty; Response.ContentLength is the size of the file.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Transfers")
+    static FHttpRequestHandle DownloadToFile(
+        const FString& URL,
+        const FString& FilePath,
+        TArray<FHttpHeaderEnumValue> DefaultHeaders,
+        TArray<FHttpKeyValue> CustomHeaders,
+        bool bResume,
+        FHttpProgressDelegate OnProgress,
+        FHttpResponseDelegate Callback,
+        FHttpOptions Options
+    );
+
+    /**
+    * Upload a file as the raw request body, streamed from disk in chunks instead of being loaded into memory.
+    * Set Options.ContentType to match the file (e.g. application/octet-stream).
+    * @param Method - Usually PUT or POST.
+    * @param FilePath - File to upload (absolute, or relative to the project directory).
+    * @param OnProgress - Called on the game thread with the bytes sent so far and the file size.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Transfers")
+    static FHttpRequestHandle UploadFile(
+        const FString& URL,
+        EHttpMethod Method,
+        const FString& FilePath,
+        TArray<FHttpHeaderEnumValue> DefaultHeaders,
+        TArray<FHttpKeyValue> CustomHeaders,
+        TArray<FHttpKeyValue> QueryParams,
+        FHttpProgressDelegate OnProgress,
+        FHttpResponseDelegate Callback,
+        FHttpOptions Options
+    );
+
+    /**
+    * Send a multipart/form-data request. File parts are streamed from disk while the body is sent.
+    * The boundary and Content-Type header are generated; Options.ContentType is ignored.
+    * @param Parts - Form fields and files, built with MakeMultipartField / MakeMultipartFile.
+    * @param OnProgress - Called on the game thread with the bytes sent so far and the total body size.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Transfers")
+    static FHttpRequestHandle SendMultipartRequest(
+        const FString& URL,
+        EHttpMethod Method,
+        TArray<FHttpHeaderEnumValue> DefaultHeaders,
+        TArray<FHttpKeyValue> CustomHeaders,
+        TArray<FHttpKeyValue> QueryParams,
+        TArray<FHttpMultipartPart> Parts,
+        FHttpProgressDelegate OnProgress,
+        FHttpResponseDelegate Callback,
+        FHttpOptions Options
+    );
+
+    /**
+    * Open a server-sent events (text/event-stream) connection and receive events as they arrive, instead of polling.
+    * Events are parsed on the HTTP thread and delivered on the game thread. Dropped connections are reopened with the
+    * Last-Event-ID header so the server can resume where the stream left off.
+    * @param OnEvent - Called on the game thread for every event.
+    * @param OnClosed - Called once when the stream ends for good: closed with CancelHttpRequest / the handle's tag,
+    *                   rejected by the server (non-200 or not an event stream), or out of reconnect attempts.
+    * @return Handle of the whole stream across reconnects; cancel it to close the stream.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Streaming")
+    static FHttpRequestHandle OpenEventStream(
+        const FString& URL,
+        TArray<FHttpHeaderEnumValue> DefaultHeaders,
+        TArray<FHttpKeyValue> CustomHeaders,
+        TArray<FHttpKeyValue> QueryParams,
+        FHttpServerEventDelegate OnEvent,
+        FHttpResponseDelegate OnClosed,
+        FHttpStreamOptions StreamOptions,
+        FHttpOptions Options
+    );
+
+    /**
+    * Send a request and receive the response body as text chunks while it downloads (chunked responses, streamed
+    * text generation). Chunks always end on a whole UTF-8 character. Not reconnected; Response.Data stays empty.
+    * @param OnChunk - Called on the game thread with each piece of the body, in order.
+    * @param Callback - Called once after the last chunk.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Streaming")
+    static FHttpRequestHandle StreamHttpRequest(
+        const FString& URL,
+        EHttpMethod Method,
+        TArray<FHttpHeaderEnumValue> DefaultHeaders,
+        TArray<FHttpKeyValue> CustomHeaders,
+        TArray<FHttpKeyValue> QueryParams,
+        const FString& JsonBody,
+        FHttpStreamChunkDelegate OnChunk,
+        FHttpResponseDelegate Callback,
+        FHttpStreamOptions StreamOptions,
+        FHttpOptions Options
+    );
+
+    /**
+    * Create a text field for a multipart request.
+    */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Transfers")
+    static FHttpMultipartPart MakeMultipartField(const FString& Name, const FString& Value);
+
+    /**
+    * Create a file part for a multipart request. The file is read while the request is sent.
+    * @param FileName - Name reported to the server (defaults to the file's own name).
+    * @param ContentType - MIME type of the file (defaults to application/octet-stream).
+    */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Transfers")
+    static FHttpMultipartPart MakeMultipartFile(const FString& Name, const FString& FilePath, const FString& FileName = TEXT(""), const FString& ContentType = TEXT(""));
+
+    /**
+    * Bundle request parameters into a descriptor (used by clients and batches).
+    */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Helpers")
+    static FHttpRequestDescriptor MakeRequestDescriptor(
+        const FString& URL,
+        EHttpMethod Method,
+        TArray<FHttpHeaderEnumValue> DefaultHeaders,
+        TArray<FHttpKeyValue> CustomHeaders,
+        TArray<FHttpKeyValue> QueryParams,
+        TArray<FHttpKeyValue> Body,
+        FHttpOptions Options
+    );
+
     /**
     * Quick GET request with minimal parameters
     * @param URL - The endpoint URL
@@ -211,7 +891,7 @@ public:
     * @param Options - Optional settings (uses defaults if not provided)
     */
     UFUNCTION(BlueprintCallable, Category = "HTTP Request | Quick Methods")
-    static void QuickGet(
+    static FHttpRequestHandle QuickGet(
         const FString& URL,
         FHttpResponseDelegate Callback,
         FHttpOptions Options = FHttpOptions()
@@ -220,12 +900,12 @@ public:
     /**
     * Quick POST request with JSON body
     * @param URL - The endpoint URL
-    * @param JsonBody - JSON string to send as body
+    * @param JsonBody - JSON string to send as body, unchanged
     * @param Callback - Delegate called on completion
     * @param Options - Optional settings
     */
     UFUNCTION(BlueprintCallable, Category = "HTTP Request | Quick Methods")
-    static void QuickPost(
+    static FHttpRequestHandle QuickPost(
         const FString& URL,
         const FString& JsonBody,
         FHttpResponseDelegate Callback,
@@ -273,6 +953,31 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "HTTP Request | Helpers")
     static FString GetStatusText(int32 StatusCode);
 
+    /**
+    * Get the response body as a string. Returns Data, or converts the raw Content (UTF-8) when the request used bRawResponse.
+    * The conversion happens on each call, so keep the result if you need it more than once.
+    */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Helpers")
+    static FString GetResponseContentAsString(const FHttpResponseSimple& Response);
+
+    /**
+    * Look up a response header by name, ignoring case (e.g. "ETag", "content-type").
+    * Works even when Options.bSplitResponseHeaders is off, by scanning the unsplit header lines.
+    * @param Response - Response returned by SendHttpRequest or a quick method.
+    * @param Name - The header name.
+    * @param Value - The header value, or empty if the header is missing.
+    * @return True if the header is present.
+    */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Helpers")
+    static bool GetResponseHeader(const FHttpResponseSimple& Response, const FString& Name, FString& Value);
+
+    /**
+    * Get every response header as key-value pairs. Returns Response.Headers when it was filled,
+    * otherwise splits the headers now; keep the result if you need it more than once.
+    */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Helpers")
+    static TArray<FHttpKeyValue> GetResponseHeaders(const FHttpResponseSimple& Response);
+
     /**
     * Helper to create a key-value pair for headers or params.
     */
@@ -292,6 +997,103 @@ public:
     UFUNCTION(BlueprintCallable, Category = "HTTP Request")
     static void DecodeJson(const FString& JsonString, const FString& KeyPath, EJsonDecodeResult& Result, FString& Value, TArray<FHttpKeyValue>& ObjectFields, TArray<FString>& ArrayValues);
 
+    /**
+    * Get queue depth and in-flight counts of the request scheduler.
+    */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Scheduler")
+    static FHttpSchedulerStats GetHttpSchedulerStats();
+
+    /**
+    * Configure the request scheduler.
+    * @param MaxInFlight - Maximum requests in flight across all hosts (Critical requests are exempt).
+    * @param MaxPerHost - Default maximum concurrent requests per host.
+    * @param MaxBackgroundInFlight - Maximum Background priority requests in flight.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Scheduler")
+    static void SetHttpSchedulerLimits(int32 MaxInFlight = 32, int32 MaxPerHost = 6, int32 MaxBackgroundInFlight = 8);
+
+    /**
+    * Override the concurrency limit for one host (0 restores the default).
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Scheduler")
+    static void SetHttpHostConcurrencyLimit(const FString& Host, int32 MaxConcurrent);
+
+    /**
+    * Limit the request rate to a host with a token bucket. Requests beyond the limit wait for a token.
+    * @param Host - Host name (e.g. "api.example.com"), or empty to set the default for every host.
+    * @param RequestsPerSecond - Sustained rate; 0 disables the limit.
+    * @param Burst - Requests that may go out back to back before the rate applies.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Scheduler")
+    static void SetHttpRateLimit(const FString& Host, float RequestsPerSecond, int32 Burst = 1);
+
+    /**
+    * Enable or configure the per-host circuit breaker (off by default). After FailureThreshold consecutive failures (no response or 5xx)
+    * requests to that host fail immediately with ErrorKind CircuitOpen for OpenSeconds, then a single probe is let through.
+    * @param FailureThreshold - Consecutive failures that open the circuit; 0 disables the breaker.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Scheduler")
+    static void SetHttpCircuitBreaker(int32 FailureThreshold = 5, float OpenSeconds = 30.0f);
+
+    /**
+    * Current circuit breaker state for a host.
+    */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Scheduler")
+    static EHttpCircuitState GetHttpCircuitState(const FString& Host);
+
+    /**
+    * Number of requests that joined an identical in-flight GET instead of sending their own (Options.bCoalesceInFlight).
+    */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Scheduler")
+    static int64 GetCoalescedRequestCount();
+
+    /**
+    * Cancel a request. Its callback still runs once, with ErrorKind Cancelled; a request already on the wire is aborted.
+    * @return False if the handle is invalid or the request already finished or was cancelled.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Handles")
+    static bool CancelHttpRequest(const FHttpRequestHandle& Handle);
+
+    /**
+    * Cancel every unfinished request sent with this Options.Tag (e.g. everything started by a screen that is closing).
+    * @return How many requests were cancelled.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Handles")
+    static int32 CancelHttpRequestsByTag(FName Tag);
+
+    /** Cancel every unfinished request. Returns how many were cancelled. */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Handles")
+    static int32 CancelAllHttpRequests();
+
+    /** Where a request is: queued (waiting for a slot, token or retry), in flight, or finished. None for an invalid handle. */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Handles")
+    static EHttpRequestState GetHttpRequestState(const FHttpRequestHandle& Handle);
+
+    /**
+    * Bytes moved by the current attempt.
+    * @param BytesExpected - Response size from Content-Length, 0 until the headers arrive or if the server does not send it.
+    * @return Download progress from 0 to 1, or -1 while the response size is unknown.
+    */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Handles")
+    static float GetHttpRequestProgress(const FHttpRequestHandle& Handle, int64& BytesSent, int64& BytesReceived, int64& BytesExpected);
+
+    /** Unfinished requests with this tag, or all of them when Tag is None. */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Handles")
+    static int32 GetActiveHttpRequestCount(FName Tag);
+
+    /**
+    * Get hit / revalidation / miss counts of the response cache.
+    */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Cache")
+    static FHttpCacheStats GetHttpCacheStats();
+
+    /**
+    * Drop every cached response.
+    * @param bIncludeDisk - Also delete the on-disk tier (Saved/MasterHttpCache).
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Cache")
+    static void ClearHttpResponseCache(bool bIncludeDisk = true);
+
     /**
     * Set default headers for JSON APIs (Content-Type, Accept, etc.).
     */
@@ -299,7 +1101,42 @@ public:
     static TArray<FHttpKeyValue> GetDefaultJsonHeaders();
 
     /**
-    * Real-time debug output (internal use).
+    * Request counts, status classes, bytes and latency percentiles (call to completion) recorded since startup or the last reset.
+    * @param bPerRoute - One entry per route ("GET /items/{id}"), or one per host.
+    */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Metrics")
+    static TArray<FHttpMetricsEntry> GetHttpMetrics(bool bPerRoute = true);
+
+    /** Clear all recorded metrics. */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Metrics")
+    static void ResetHttpMetrics();
+
+    /**
+    * Write the metrics to Saved/MasterHttpMetrics/metrics.csv or metrics.json every IntervalSeconds, in the background.
+    * @param IntervalSeconds - Time between exports; 0 stops exporting.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Metrics")
+    static void SetHttpMetricsExport(float IntervalSeconds = 60.0f, EHttpMetricsExportFormat Format = EHttpMetricsExportFormat::Csv);
+
+    /** Write the metrics now. Returns the file written. */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Metrics")
+    static FString ExportHttpMetrics(EHttpMetricsExportFormat Format = EHttpMetricsExportFormat::Csv);
+
+    /**
+    * Configure the debug log file written at Detailed / Verbose debug levels.
+    * @param Format - Human-readable reports (MasterHttp.log) or one JSON object per line (MasterHttp.ndjson).
+    * @param MaxFileSizeMB - Size at which the file is rotated to MasterHttp.1.log and a new one started.
+    * @param MaxFiles - Files kept, including the current one.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | Debug")
+    static void SetHttpDebugLogSettings(EHttpDebugLogFormat Format = EHttpDebugLogFormat::Text, int32 MaxFileSizeMB = 10, int32 MaxFiles = 5);
+
+    /** Path of the current debug log file. */
+    UFUNCTION(BlueprintPure, Category = "HTTP Request | Debug")
+    static FString GetHttpDebugLogPath();
+
+    /**
+    * Real-time debug output (internal use). Detailed reports are formatted and written by a background thread.
     */
     static void LogDebugInfo(const FString& URL, EHttpMethod Method, const TArray<FHttpKeyValue>& QueryParams, const TArray<FHttpKeyValue>& Headers, const TArray<FHttpKeyValue>& Body, const FHttpResponseSimple& Response, const FHttpOptions& Options);
 };
@@ -0,0 +1,165 @@
+/*
+==========================================================================================
+File: MasterJsonDocument.h
+Author: Mario Tarosso
+Year: 2025
+Publisher: MJGT Studio
+==========================================================================================
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Dom/JsonValue.h"
+#include "MasterHttpRequestBPLibrary.h"
+#include "MasterJsonDocument.generated.h"
+
+class UMasterJsonDocument;
+
+/**
+ * Matches of one path from a multi-path query, split by JSON type.
+ * Each array keeps its matches in document order; a path without wildcards has at most one match.
+ */
+USTRUCT(BlueprintType)
+struct FJsonQueryResult
+{
+    GENERATED_BODY()
+
+    /** The path as it was passed to the query. */
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP Request | JSON")
+    FString Path;
+
+    /** False if the path could not be parsed (e.g. "items[x]"). */
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP Request | JSON")
+    bool bValidPath = false;
+
+    /** Total matches across all the typed arrays below (null values are counted but not stored). */
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP Request | JSON")
+    int32 MatchCount = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP Request | JSON")
+    TArray<FString> Strings;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP Request | JSON")
+    TArray<double> Numbers;
+
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP Request | JSON")
+    TArray<bool> Bools;
+
+    /** Object and array matches, as sub documents sharing the parsed tree (nothing is serialized). */
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP Request | JSON")
+    TArray<TObjectPtr<UMasterJsonDocument>> Documents;
+};
+
+/**
+ * A JSON document parsed once and queried many times.
+ * Lookups use the same key paths as DecodeJson ("data.user.email", "items[3].id") and every resolved
+ * path is cached, so sibling fields share the walk to their common parent.
+ * Documents are meant to be used from one thread at a time (usually the game thread).
+ */
+UCLASS(BlueprintType)
+class MASTERHTTPREQUEST_API UMasterJsonDocument : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+    * Parse a JSON string into a reusable document.
+    * @param JsonString - The JSON text (object or array at the root).
+    * @param bSuccess - True if the string was valid JSON.
+    * @return The parsed document, or nullptr on failure.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | JSON")
+    static UMasterJsonDocument* ParseJsonString(const FString& JsonString, bool& bSuccess);
+
+    /**
+    * Parse UTF-8 encoded JSON bytes into a reusable document without an intermediate FString.
+    * @param Bytes - UTF-8 JSON payload.
+    * @param bSuccess - True if the bytes were valid JSON.
+    * @return The parsed document, or nullptr on failure.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | JSON")
+    static UMasterJsonDocument* ParseJsonBytes(const TArray<uint8>& Bytes, bool& bSuccess);
+
+    /**
+    * Parse the body of an HTTP response into a reusable document.
+    * @param Response - Response returned by SendHttpRequest or a quick method.
+    * @param bSuccess - True if the response body was valid JSON.
+    * @return The parsed document, or nullptr on failure.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | JSON")
+    static UMasterJsonDocument* ParseJsonResponse(const FHttpResponseSimple& Response, bool& bSuccess);
+
+    /** Wrap an already parsed JSON value (C++ only). */
+    static UMasterJsonDocument* FromJsonValue(const TSharedPtr<FJsonValue>& RootValue, UObject* Outer = nullptr);
+
+    /** Check whether a value exists at the given path. */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "HTTP Request | JSON")
+    bool HasField(const FString& KeyPath);
+
+    /** Read a string value. Numbers and booleans are converted the same way DecodeJson does. */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | JSON")
+    bool GetString(const FString& KeyPath, FString& Value);
+
+    /** Read a numeric value. */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | JSON")
+    bool GetNumber(const FString& KeyPath, double& Value);
+
+    /** Read a boolean value. */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | JSON")
+    bool GetBool(const FString& KeyPath, bool& Value);
+
+    /**
+    * Get a nested object as its own document. The sub document shares the parsed tree, nothing is re-parsed.
+    * @return The sub document, or nullptr if the path is not an object.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | JSON")
+    UMasterJsonDocument* GetObject(const FString& KeyPath, bool& bSuccess);
+
+    /** Get the fields of an object as key-value pairs (nested values are serialized to JSON). */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | JSON")
+    bool GetObjectFields(const FString& KeyPath, TArray<FHttpKeyValue>& ObjectFields);
+
+    /** Get the elements of an array as strings (objects and arrays are serialized to JSON). */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | JSON")
+    bool GetArray(const FString& KeyPath, TArray<FString>& ArrayValues);
+
+    /**
+    * Evaluate many paths in a single walk of the document. Paths may index arrays ("items[3].id", "items[-1]")
+    * and use wildcards ("items[*].price", "stats.*.value").
+    * @param Paths - The paths to evaluate.
+    * @param Results - One entry per path, in the same order, with the matches split by type.
+    * @return False if any path could not be parsed.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | JSON")
+    bool Query(const TArray<FString>& Paths, TArray<FJsonQueryResult>& Results);
+
+    /**
+    * Parse a JSON string and evaluate many paths against it, with a single parse and a single walk.
+    * @param JsonString - The JSON text (object or array at the root).
+    * @param Paths - The paths to evaluate (see Query).
+    * @param Results - One entry per path, in the same order.
+    * @return False if the string is not valid JSON or any path could not be parsed.
+    */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | JSON")
+    static bool QueryJsonString(const FString& JsonString, const TArray<FString>& Paths, TArray<FJsonQueryResult>& Results);
+
+    /** Serialize the value at the given path (or the whole document if empty) back to JSON. */
+    UFUNCTION(BlueprintCallable, Category = "HTTP Request | JSON")
+    FString ToJsonString(const FString& KeyPath = TEXT(""));
+
+    /** Resolve a path to the underlying JSON value (C++ only). Returns an invalid pointer if not found. */
+    TSharedPtr<FJsonValue> FindValue(const FString& KeyPath);
+
+    /** Root of the parsed tree (C++ only). */
+    const TSharedPtr<FJsonValue>& GetRootValue() const { return RootValue; }
+
+    /** Convert a scalar or nested JSON value to the string form used across the plugin. */
+    static FString JsonValueToString(const TSharedPtr<FJsonValue>& JsonValue);
+
+private:
+    TSharedPtr<FJsonValue> RootValue;
+
+    /** Resolved paths, including misses, so repeated lookups never walk the tree twice. */
+    TMap<FString, TSharedPtr<FJsonValue>> PathCache;
+};